@@ -0,0 +1,237 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+
+    /*
+        ===============================
+        MosTree Class — Function Complexities
+        ===============================
+
+        Mo's algorithm over tree paths. Each node v appears twice on the entry/exit tour, at
+        tin[v] and tout[v]. For a path (u, v) with tin[u] <= tin[v]:
+            lca == u → tour range [tin[u], tin[v]]
+            else     → tour range [tout[u], tin[v]], plus the lca, which is toggled in just for the answer
+        Walking a tour position toggles its node: a node seen twice in the range is off the path.
+        The policy therefore works on node ids and keeps MosAlgorithm's hooks unchanged.
+
+        1. MosTree(adj, values, root, order)   → Build tour + LCA with an iterative DFS | Time: O(n log n) | Space: O(n log n)
+        2. MosTree(tour, values, order)        → Reuse a built EulerTour (type 0) or anything with
+                                                 getTin / getTout / getParentArray / getDepthArray | Time: O(n log n)
+        3. addQuery(u, v, idx)                 → Path query between nodes u and v | Time: O(log n) (LCA)
+        4. process()                           → Answers in original order | Time: O(n * √q + q log q) | Space: O(n + q)
+        5. lca(u, v)                           → Lowest common ancestor (binary lifting) | Time: O(log n)
+        6. policy()                            → Access the user state | Time: O(1)
+
+        --- Policy (same as MosAlgorithm, indices are node ids) ---
+            Policy(const vector<T>& values)   → Build the state for an empty path
+            void add(int v) / void remove(int v)
+            AnswerType answer()
+        MosDistinctCount<T, AnswerType> (default) → distinct values on the path.
+
+        Where:
+            n      = number of nodes (0-based), adj = adjacency lists of a connected tree, root = DFS root
+            values = value per node
+            order  = MosOrder::BLOCK (default, B = 2n / √q) or MosOrder::HILBERT over the 2n-long tour
+
+        Usage Example:
+            MosTree<int> mt(adj, color);               // distinct colors on u–v paths
+            mt.addQuery(3, 7, 0);
+            mt.addQuery(0, 5, 1);
+            vector<long long> ans = mt.process();
+    */
+
+
+
+#ifndef MOS_COMMON_DEFINED
+#define MOS_COMMON_DEFINED
+    enum class MosOrder { BLOCK, HILBERT };
+
+    // Index of (x, y) along the Hilbert curve filling [0, 2^pw)²
+    inline uint64_t hilbertOrder(int x, int y, int pw) {
+        uint64_t d = 0;
+        int side = 1 << pw;
+        for (int s = side >> 1; s > 0; s >>= 1) {
+            int rx = (x & s) > 0, ry = (y & s) > 0;
+            d += (uint64_t)s * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) { x = side - 1 - x; y = side - 1 - y; }
+                swap(x, y);
+            }
+        }
+        return d;
+    }
+
+    template <typename T, typename AnswerType = long long>
+    class MosDistinctCount {
+        vector<int> comp;                   // compressed value per position
+        vector<int> freq;                   // one slot per distinct value
+        AnswerType distinct = 0;
+
+    public:
+        explicit MosDistinctCount(const vector<T>& arr) : comp(arr.size()) {
+            vector<T> vals(arr);
+            sort(vals.begin(), vals.end());
+            vals.erase(unique(vals.begin(), vals.end()), vals.end());
+            for (size_t i = 0; i < arr.size(); i++)
+                comp[i] = int(lower_bound(vals.begin(), vals.end(), arr[i]) - vals.begin());
+            freq.assign(vals.size(), 0);
+        }
+
+        void add(int idx) { if (freq[comp[idx]]++ == 0) distinct++; }
+        void remove(int idx) { if (--freq[comp[idx]] == 0) distinct--; }
+        AnswerType answer() const { return distinct; }
+
+        // MosAlgorithmWithUpdates: position idx takes the value of slot src
+        void assign(int idx, int src) { comp[idx] = comp[src]; }
+    };
+#endif
+
+
+
+    template <typename T, typename AnswerType = long long, typename Policy = MosDistinctCount<T, AnswerType>>
+    class MosTree {
+    private:
+        struct Query {
+            int l, r, lca, idx;             // tour range [l, r]; lca = -1 if it is an endpoint
+            uint64_t key = 0;
+        };
+
+        int n = 0, LOG = 1;
+        MosOrder order;
+        vector<int> tin, tout, depth;
+        vector<int> tour;                   // tour[p] = node at tour position p (size 2n)
+        vector<int> up;                     // up[k * n + v] = 2^k-th ancestor (root points to itself)
+        vector<char> on;                    // node currently counted
+        Policy state;
+        vector<Query> queries;
+        vector<AnswerType> answers;
+
+        void buildLifting(const vector<int>& parent) {
+            LOG = 1;
+            while ((1 << LOG) < n) LOG++;
+            up.assign((size_t)LOG * n, 0);
+            for (int v = 0; v < n; v++) up[v] = parent[v] < 0 ? v : parent[v];
+            for (int k = 1; k < LOG; k++)
+                for (int v = 0; v < n; v++) up[(size_t)k * n + v] = up[(size_t)(k - 1) * n + up[(size_t)(k - 1) * n + v]];
+        }
+
+        void buildTour() {
+            tour.assign(2 * n, 0);
+            for (int v = 0; v < n; v++) {
+                if (tin[v] < 0 || tout[v] < 0 || tin[v] >= 2 * n || tout[v] >= 2 * n)
+                    throw invalid_argument("MosTree: tour must be an entry/exit tour covering every node");
+                tour[tin[v]] = tour[tout[v]] = v;
+            }
+            on.assign(n, 0);
+        }
+
+        inline void toggle(int v) {
+            if (on[v]) state.remove(v);
+            else state.add(v);
+            on[v] ^= 1;
+        }
+
+        void sortQueries() {
+            int len = 2 * n;
+            if (order == MosOrder::HILBERT) {
+                int pw = 0;
+                while ((1 << pw) < len) pw++;
+                for (auto& q : queries) q.key = hilbertOrder(q.l, q.r, pw);
+                sort(queries.begin(), queries.end(), [](const Query& a, const Query& b) { return a.key < b.key; });
+                return;
+            }
+            int blockSize = max(1, (int)(len / sqrt(max<size_t>(1, queries.size()))));
+            sort(queries.begin(), queries.end(), [&](const Query& a, const Query& b) {
+                int blockA = a.l / blockSize, blockB = b.l / blockSize;
+                if (blockA != blockB) return blockA < blockB;
+                return (blockA & 1) ? (a.r > b.r) : (a.r < b.r);
+            });
+        }
+
+    public:
+        MosTree(const vector<vector<int>>& adj, const vector<T>& values, int root = 0, MosOrder ord = MosOrder::BLOCK)
+            : n((int)adj.size()), order(ord), state(values) {
+            if ((int)values.size() != n) throw invalid_argument("MosTree: one value per node expected");
+            if (n == 0) return;
+            tin.assign(n, -1); tout.assign(n, -1); depth.assign(n, 0);
+            vector<int> parent(n, -1), it(n, 0), stk;
+            stk.reserve(n);
+            int timer = 0;
+            stk.push_back(root);
+            tin[root] = timer++;
+            while (!stk.empty()) {
+                int v = stk.back();
+                if (it[v] < (int)adj[v].size()) {
+                    int to = adj[v][it[v]++];
+                    if (to == parent[v]) continue;
+                    parent[to] = v;
+                    depth[to] = depth[v] + 1;
+                    tin[to] = timer++;
+                    stk.push_back(to);
+                } else {
+                    tout[v] = timer++;
+                    stk.pop_back();
+                }
+            }
+            buildTour();
+            buildLifting(parent);
+        }
+
+        template <typename Tour>
+        MosTree(const Tour& et, const vector<T>& values, MosOrder ord = MosOrder::BLOCK)
+            : n((int)values.size()), order(ord),
+              tin(et.getTin()), tout(et.getTout()), depth(et.getDepthArray()), state(values) {
+            if (n == 0) return;
+            buildTour();
+            buildLifting(et.getParentArray());
+        }
+
+        int lca(int u, int v) const {
+            if (depth[u] < depth[v]) swap(u, v);
+            int diff = depth[u] - depth[v];
+            for (int k = 0; diff; k++, diff >>= 1) if (diff & 1) u = up[(size_t)k * n + u];
+            if (u == v) return u;
+            for (int k = LOG - 1; k >= 0; k--) {
+                int a = up[(size_t)k * n + u], b = up[(size_t)k * n + v];
+                if (a != b) { u = a; v = b; }
+            }
+            return up[u];
+        }
+
+        // Path query between u and v (inclusive), answered at index idx
+        void addQuery(int u, int v, int idx) {
+            if (u < 0 || v < 0 || u >= n || v >= n) throw out_of_range("MosTree::addQuery - invalid node");
+            if (tin[u] > tin[v]) swap(u, v);
+            int w = lca(u, v);
+            if (w == u) queries.push_back({tin[u], tin[v], -1, idx});
+            else queries.push_back({tout[u], tin[v], w, idx});
+        }
+
+        // Answer all queries (the policy starts from and is returned to the empty path)
+        vector<AnswerType> process() {
+            answers.assign(queries.size(), AnswerType());
+            sortQueries();
+            int L = 0, R = -1;
+            for (const Query& q : queries) {
+                while (L > q.l) toggle(tour[--L]);
+                while (R < q.r) toggle(tour[++R]);
+                while (L < q.l) toggle(tour[L++]);
+                while (R > q.r) toggle(tour[R--]);
+                if (q.lca >= 0) toggle(q.lca);
+                answers[q.idx] = state.answer();
+                if (q.lca >= 0) toggle(q.lca);
+            }
+            while (L <= R) toggle(tour[L++]);
+            return answers;
+        }
+
+        Policy& policy() { return state; }
+    };
+}
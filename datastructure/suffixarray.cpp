@@ -25,7 +25,7 @@ inline namespace MY{
         2.  build_sa()                      → Time: O(n log n)         | Space: O(n)
         3.  build_rank()                    → Time: O(n)               | Space: O(n)
         4.  build_lcp() (Kasai)             → Time: O(n)               | Space: O(n)
-        5.  build_rmq()                     → Time: O(n log n)         | Space: O(n log n)
+        5.  build_rmq() (LinearRMQ)         → Time: O(n)               | Space: O(n)
         6.  build_numSubstrings()           → Time: O(n)               | Space: O(n)
 
         Query Operations:
@@ -64,11 +64,104 @@ inline namespace MY{
         • All builds are lazy — functions like LCP/RMQ only build once.
         • kthSubstring relies on suffix uniqueness via prefix sums.
         • For large alphabets, complexity stays unchanged due to stable radix sort.
-        • Memory footprint: ~O(n log n) due to sparse table for RMQ.
+        • Memory footprint: O(n) — the LCP RMQ is a LinearRMQ (64-wide blocks + bitmasks),
+          not an n log n sparse table (see rangeQueries/sparseTable/LinearRMQ.cpp).
     */
 
 
 
+#ifndef LINEAR_RMQ_DEFINED
+#define LINEAR_RMQ_DEFINED
+    template <typename T, typename Compare = less<T>>
+    class LinearRMQ {
+    private:
+        static constexpr int B = 64;
+
+        vector<T> a;
+        vector<uint64_t> masks;        // masks[i]: in-block stack after position i
+        struct Entry { T v; int i; };
+        vector<Entry> table;           // sparse table over block extrema, level k at k · nb
+        int n = 0, nb = 0;
+        Compare cmp;
+
+        // leftmost of two candidate indices on ties (requires x < y)
+        inline const Entry& better(const Entry& x, const Entry& y) const { return cmp(y.v, x.v) ? y : x; }
+
+        inline Entry at(int i) const { return {a[i], i}; }
+
+        inline int inBlock(int l, int r) const {
+            uint64_t m = masks[r] & (~0ULL << (l & (B - 1)));
+            return (l & ~(B - 1)) + __builtin_ctzll(m);
+        }
+
+        [[noreturn]] __attribute__((noinline, cold)) void invalidRange() const {
+            if (n == 0) throw out_of_range("LinearRMQ: empty");
+            throw out_of_range("LinearRMQ::query - invalid range");
+        }
+
+        void build() {
+            n = (int)a.size();
+            nb = (n + B - 1) / B;
+            masks.assign(n, 0);
+
+            for (int b = 0; b < nb; ++b) {
+                int base = b * B, end = min(n, base + B);
+                uint64_t st = 0;
+                for (int i = base; i < end; ++i) {
+                    // pop strictly worse tops so that equal values keep the leftmost index
+                    while (st) {
+                        int top = base + 63 - __builtin_clzll(st);
+                        if (!cmp(a[i], a[top])) break;
+                        st ^= 1ULL << (top - base);
+                    }
+                    st |= 1ULL << (i - base);
+                    masks[i] = st;
+                }
+            }
+
+            int levels = nb ? 32 - __builtin_clz((unsigned)nb) : 0;
+            table.resize((size_t)levels * nb);
+            for (int b = 0; b < nb; ++b) table[b] = at(b * B + __builtin_ctzll(masks[min(n, b * B + B) - 1]));
+            for (int k = 1; k < levels; ++k) {
+                const Entry* prev = table.data() + (size_t)(k - 1) * nb;
+                Entry* cur = table.data() + (size_t)k * nb;
+                int half = 1 << (k - 1);
+                for (int i = 0; i + (1 << k) <= nb; ++i) cur[i] = better(prev[i], prev[i + half]);
+            }
+        }
+
+        // block table entries carry their value, so a query touches a[] only at the two ends
+        Entry best(int l, int r) const {
+            if (__builtin_expect((unsigned)r >= (unsigned)n || (unsigned)l > (unsigned)r, 0)) invalidRange();
+            int bl = l / B, br = r / B;
+            if (bl == br) return at(inBlock(l, r));
+            Entry res = at(inBlock(l, bl * B + B - 1));
+            if (bl + 1 < br) {
+                int lo = bl + 1, hi = br - 1;
+                int k = 31 - __builtin_clz((unsigned)(hi - lo + 1));
+                const Entry* row = table.data() + (size_t)k * nb;
+                res = better(res, better(row[lo], row[hi - (1 << k) + 1]));
+            }
+            return better(res, at(inBlock(br * B, r)));
+        }
+
+    public:
+        LinearRMQ() = default;
+
+        explicit LinearRMQ(vector<T> arr, Compare c = Compare()) : a(move(arr)), cmp(c) {
+            build();
+        }
+
+        int queryIndex(int l, int r) const { return best(l, r).i; }
+
+        T query(int l, int r) const { return best(l, r).v; }
+
+        int size() const { return n; }
+    };
+#endif
+
+
+
     class SuffixArray {
         string s;               // original string + sentinel '\0'
         int n0;                 // original length (without sentinel)
@@ -76,8 +169,7 @@ inline namespace MY{
         vector<int> sa;         // suffix array (indices into s)
         vector<int> rank_;      // rank_[i] = position of suffix i in SA
         vector<int> lcp;        // LCP between adjacent suffixes in SA (size n-1)
-        vector<vector<int>> st; // sparse table for RMQ on lcp
-        vector<int> lg2;
+        LinearRMQ<int> rmq;     // O(1) range-min on lcp
         vector<long long> numSubstrings;
         bool lcp_built = false, rmq_built = false;
 
@@ -189,26 +281,7 @@ inline namespace MY{
         void build_rmq() {
             if (rmq_built) return;
             build_lcp();
-            int m = (int)lcp.size();
-            if (m == 0) { // nothing to build; LCPs are all zero / single suffix
-                lg2.assign(1, 0);
-                rmq_built = true;
-                return;
-            }
-
-            lg2.assign(m + 1, 0);
-            lg2[0] = 0;
-            if (m >= 1) lg2[1] = 0;
-            for (int i = 2; i <= m; ++i) lg2[i] = lg2[i / 2] + 1;
-
-            int K = lg2[m] + 1;
-            st.assign(K, vector<int>(m));
-            st[0] = lcp;
-            for (int k = 1; k < K; k++) {
-                for (int i = 0; i + (1 << k) <= m; i++) {
-                    st[k][i] = min(st[k - 1][i], st[k - 1][i + (1 << (k - 1))]);
-                }
-            }
+            rmq = LinearRMQ<int>(lcp);
             rmq_built = true;
         }
 
@@ -219,10 +292,8 @@ inline namespace MY{
             if (lcp.empty()) return 0; // CRUCIAL: avoid out-of-range access
             int ri = rank_[i], rj = rank_[j];
             if (ri > rj) swap(ri, rj);
-            int len = rj - ri;
-            if (len <= 0) return 0;
-            int k = lg2[len];
-            return min(st[k][ri], st[k][rj - (1 << k)]);
+            if (ri == rj) return 0;
+            return rmq.query(ri, rj - 1);
         }
 
         // Pattern range in SA (lower, upper) [lower, upper)
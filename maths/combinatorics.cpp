@@ -57,24 +57,152 @@ inline namespace MY{
      *  - segmentedSieve efficiently computes primes in a given range [L, R].
      *  - All combinatorial functions return 0 for invalid inputs.
      *
+     *  Modular Backend:
+     *  ----------------
+     *  CombinatoricsT<Reducer> keeps fact/invFact in Reducer's internal form
+     *  and does every multiplication modulo the init() modulus through it
+     *  (Int128Reducer, BarrettReducer, MontgomeryReducer, StaticMontgomery<MOD>;
+     *  see maths/modint.cpp). If Reducer cannot handle the modulus (e.g. an
+     *  even modulus for Montgomery) init() throws invalid_argument, as
+     *  BIT_prodMod and SegTreeAdv1D/2D do; the lazy init() behind factorial()
+     *  etc. uses 1e9+7, so such a Reducer needs an explicit init(n, m).
+     *  Combinatorics = CombinatoricsT<Int128Reducer> keeps the original API.
+     *
+     *      using Comb = CombinatoricsT<StaticMontgomery<998244353>>;
+     *      Comb::init(1000000, 998244353);
+     *      long long c = Comb::nCr(10, 3, 998244353);
+     *
      * ================================================================
      */
 
 
+#ifndef MOD_REDUCERS_DEFINED
+#define MOD_REDUCERS_DEFINED
+    struct Int128Reducer {
+        uint64_t m;
+        explicit Int128Reducer(uint64_t mod = 1000000007ULL) : m(mod) {}
+        static bool supports(uint64_t mod) { return mod >= 1; }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const { return (uint64_t)((unsigned __int128)a * b % m); }
+    };
 
-    class Combinatorics {
+    // q = floor(z / m) up to one, from the high half of z · ceil(2^64 / m)
+    struct BarrettReducer {
+        uint64_t m, im;
+        explicit BarrettReducer(uint64_t mod = 998244353ULL) : m(mod), im(~0ULL / mod + 1) {}
+        static bool supports(uint64_t mod) { return mod >= 1 && mod < (1ULL << 32); }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const {
+            uint64_t z = a * b;
+            uint64_t x = (uint64_t)(((unsigned __int128)z * im) >> 64);
+            uint64_t y = x * m;
+            return z - y + (z < y ? m : 0);
+        }
+    };
+
+    // Internal form a · 2^64 mod m; reduce(t) = t · 2^-64 mod m
+    struct MontgomeryReducer {
+        uint64_t m, inv, r2;
+        explicit MontgomeryReducer(uint64_t mod = 1000000007ULL) : m(mod), inv(1) {
+            for (int i = 0; i < 6; ++i) inv *= 2 - mod * inv;          // m^-1 mod 2^64 (Newton)
+            r2 = (uint64_t)(-(unsigned __int128)mod % mod);            // 2^128 mod m
+        }
+        static bool supports(uint64_t mod) { return (mod & 1) && mod < (1ULL << 63); }
+        uint64_t reduce(unsigned __int128 t) const {
+            uint64_t q = (uint64_t)t * inv;
+            uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * m) >> 64);
+            return a >= b ? a - b : a - b + m;
+        }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return to(1); }
+        uint64_t to(uint64_t x) const { return reduce((unsigned __int128)(x % m) * r2); }
+        uint64_t from(uint64_t a) const { return reduce(a); }
+        uint64_t mul(uint64_t a, uint64_t b) const { return reduce((unsigned __int128)a * b); }
+    };
+
+    // Montgomery with MOD known at compile time; MOD < 2^31 runs entirely in 64-bit registers
+    template <uint64_t MOD>
+    struct StaticMontgomery {
+        static_assert((MOD & 1) && MOD < (1ULL << 63), "StaticMontgomery: MOD must be odd and < 2^63");
+        static constexpr bool SMALL = MOD < (1ULL << 31);
+
+        static constexpr uint64_t inv64() { uint64_t x = 1; for (int i = 0; i < 6; ++i) x *= 2 - MOD * x; return x; }
+        static constexpr uint64_t INV = inv64();
+        // SMALL uses radix 2^32 (R2 = 2^64 mod MOD), otherwise radix 2^64 (R2 = 2^128 mod MOD)
+        static constexpr uint64_t R2 = SMALL ? (uint64_t)((((unsigned __int128)1) << 64) % MOD)
+                                             : (uint64_t)((-(unsigned __int128)MOD) % MOD);
+
+        explicit StaticMontgomery(uint64_t mod = MOD) {
+            if (mod != MOD) throw invalid_argument("StaticMontgomery: modulus differs from MOD");
+        }
+        static bool supports(uint64_t mod) { return mod == MOD; }
+
+        static uint64_t reduce(unsigned __int128 t) {
+            if constexpr (SMALL) {
+                uint64_t x = (uint64_t)t;
+                uint32_t q = (uint32_t)x * (uint32_t)(0 - INV);         // -MOD^-1 mod 2^32
+                uint64_t r = (x + (uint64_t)q * MOD) >> 32;
+                return r >= MOD ? r - MOD : r;
+            } else {
+                uint64_t q = (uint64_t)t * INV;
+                uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * MOD) >> 64);
+                return a >= b ? a - b : a - b + MOD;
+            }
+        }
+        static constexpr uint64_t mod() { return MOD; }
+        static uint64_t one() { return to(1); }
+        static uint64_t to(uint64_t x) { return reduce((unsigned __int128)(x % MOD) * R2); }
+        static uint64_t from(uint64_t a) { return reduce(a); }
+        static uint64_t mul(uint64_t a, uint64_t b) {
+            if constexpr (SMALL) return reduce(a * b);
+            else return reduce((unsigned __int128)a * b);
+        }
+    };
+#endif
+
+
+
+    template <typename Reducer = Int128Reducer>
+    class CombinatoricsT {
     private:
         static const long long DEFAULT_MOD = 1000000007LL;
         static const int DEFAULT_MAXN = 2000000;
 
-        static vector<long long> fact;
-        static vector<long long> invFact;
+        static vector<long long> fact;      // internal form of the active backend
+        static vector<long long> invFact;   // internal form of the active backend
         static bool initialized;
         static long long currentMod;
         static int currentMaxN;
 
+        static Reducer red;                 // backend for currentMod
+
+        // ---------- Backend (modulo currentMod) ----------
+        static inline uint64_t toI(uint64_t x) { return red.to(x); }
+        static inline uint64_t fromI(uint64_t a) { return red.from(a); }
+        static inline uint64_t mulI(uint64_t a, uint64_t b) { return red.mul(a, b); }
+        static uint64_t powI(uint64_t a, long long b) {
+            uint64_t res = red.one();
+            while (b > 0) {
+                if (b & 1) res = mulI(res, a);
+                a = mulI(a, a);
+                b >>= 1;
+            }
+            return res;
+        }
+
         // ---------- Internal Modular Power ----------
         static long long modPow(long long a, long long b, long long m) {
+            if (initialized && m == currentMod) {
+                a %= m;
+                if (a < 0) a += m;
+                return (long long)fromI(powI(toI((uint64_t)a), b));
+            }
             long long res = 1;
             a %= m;
             while (b > 0) {
@@ -88,18 +216,22 @@ inline namespace MY{
     public:
         // ---------- Initialization ----------
         static void init(int n = DEFAULT_MAXN, long long m = DEFAULT_MOD) {
+            if (m < 1 || !Reducer::supports((uint64_t)m))
+                throw invalid_argument("Combinatorics: modulus not supported by reducer");
             currentMaxN = n;
             currentMod = m;
-            fact.assign(n + 1, 1);
-            invFact.assign(n + 1, 1);
+            red = Reducer((uint64_t)m);
+            initialized = true;
 
-            for (int i = 1; i <= n; i++) fact[i] = fact[i - 1] * i % m;
+            uint64_t one = toI(1);
+            fact.assign(n + 1, (long long)one);
+            invFact.assign(n + 1, (long long)one);
 
-            invFact[n] = modPow(fact[n], m - 2, m);
-            for (int i = n - 1; i >= 0; i--)
-                invFact[i] = invFact[i + 1] * (i + 1) % m;
+            for (int i = 1; i <= n; i++) fact[i] = (long long)mulI(fact[i - 1], toI(i));
 
-            initialized = true;
+            invFact[n] = (long long)powI(fact[n], m - 2);
+            for (int i = n - 1; i >= 0; i--)
+                invFact[i] = (long long)mulI(invFact[i + 1], toI(i + 1));
         }
 
         // ---------- Modular Arithmetic ----------
@@ -115,26 +247,26 @@ inline namespace MY{
         static long long factorial(int n, long long m = DEFAULT_MOD) {
             if (!initialized) init();
             if (n < 0 || n > currentMaxN) return 0;
-            return fact[n] % m;
+            return (long long)fromI(fact[n]) % m;
         }
 
         static long long invFactorial(int n, long long m = DEFAULT_MOD) {
             if (!initialized) init();
             if (n < 0 || n > currentMaxN) return 0;
-            return invFact[n] % m;
+            return (long long)fromI(invFact[n]) % m;
         }
 
         // ---------- Combinatorics ----------
         static long long nCr(int n, int r, long long m = DEFAULT_MOD) {
             if (!initialized) init();
             if (r < 0 || r > n || n > currentMaxN) return 0;
-            return fact[n] * invFact[r] % m * invFact[n - r] % m;
+            return (long long)fromI(mulI(mulI(fact[n], invFact[r]), invFact[n - r])) % m;
         }
 
         static long long nPr(int n, int r, long long m = DEFAULT_MOD) {
             if (!initialized) init();
             if (r < 0 || r > n) return 0;
-            return fact[n] * invFact[n - r] % m;
+            return (long long)fromI(mulI(fact[n], invFact[n - r])) % m;
         }
 
         static long long multinomial(const vector<int>& ks, long long m = DEFAULT_MOD) {
@@ -142,15 +274,15 @@ inline namespace MY{
             long long sum = 0;
             for (int k : ks) sum += k;
             if (sum > currentMaxN) return 0;
-            long long res = fact[sum];
-            for (int k : ks) res = res * invFact[k] % m;
-            return res;
+            uint64_t res = fact[sum];
+            for (int k : ks) res = mulI(res, invFact[k]);
+            return (long long)fromI(res) % m;
         }
 
         static long long catalan(int n, long long m = DEFAULT_MOD) {
             if (!initialized) init();
             long long n2 = (long long)n * 2;
-            return nCr(n2, n, m) * modInverse(n + 1, m) % m;
+            return (long long)((__int128)nCr(n2, n, m) * modInverse(n + 1, m) % m);
         }
 
         static long long nCrLarge(long long n, long long r, long long m = DEFAULT_MOD) {
@@ -250,9 +382,12 @@ inline namespace MY{
     };
 
     // ---------- Static Variable Definitions ----------
-    vector<long long> Combinatorics::fact;
-    vector<long long> Combinatorics::invFact;
-    bool Combinatorics::initialized = false;
-    long long Combinatorics::currentMod = Combinatorics::DEFAULT_MOD;
-    int Combinatorics::currentMaxN = Combinatorics::DEFAULT_MAXN;
+    template <typename Reducer> vector<long long> CombinatoricsT<Reducer>::fact;
+    template <typename Reducer> vector<long long> CombinatoricsT<Reducer>::invFact;
+    template <typename Reducer> bool CombinatoricsT<Reducer>::initialized = false;
+    template <typename Reducer> long long CombinatoricsT<Reducer>::currentMod = CombinatoricsT<Reducer>::DEFAULT_MOD;
+    template <typename Reducer> int CombinatoricsT<Reducer>::currentMaxN = CombinatoricsT<Reducer>::DEFAULT_MAXN;
+    template <typename Reducer> Reducer CombinatoricsT<Reducer>::red{};
+
+    using Combinatorics = CombinatoricsT<>;
 }
@@ -0,0 +1,207 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+
+    /*
+        ===============================
+        Modular Reducers & ModInt<R> — Function Complexities
+        ===============================
+
+        Pluggable modular-multiplication backends. Every reducer keeps residues in its own
+        internal form inside [0, mod): convert with to()/from(), multiply with mul(), and
+        add/subtract as plain residues. Structures that multiply modulo a fixed modulus
+        (BIT_prodMod, SegTreeAdv1D, SegTreeAdv2D, Combinatorics) take a reducer as a
+        template parameter and default to Int128Reducer.
+
+        Reducer interface:
+            R(mod)                 → Constructor                          | Time: O(1)
+            static supports(mod)   → Whether this backend can handle mod  | Time: O(1)
+            mod(), one()           → Modulus / internal form of 1         | Time: O(1)
+            to(x), from(a)         → Normal ↔ internal form               | Time: O(1)
+            mul(a, b)              → Product of two internal values       | Time: O(1)
+
+        Backends:
+            Int128Reducer          → (__int128)a * b % mod, any mod >= 1 (reference / fallback)
+            BarrettReducer         → Runtime mod < 2^32, high multiply instead of 128-bit division
+            MontgomeryReducer      → Runtime odd mod < 2^63, two 64x64 multiplies per product
+            StaticMontgomery<MOD>  → Compile-time odd MOD < 2^63, constants folded; 32-bit path for MOD < 2^31
+
+        ModInt<R, Tag> (value type, one modulus per (R, Tag) pair):
+            1. ModInt(x)                   → From integer (any sign)          | Time: O(1)
+            2. + - * / += -= *= /= -x      → Field operations (/ needs prime) | Time: O(1), / is O(log mod)
+            3. pow(e), inv()               → Power / Fermat inverse           | Time: O(log e) / O(log mod)
+            4. val()                       → Normal representative [0, mod)  | Time: O(1)
+            5. setMod(m), mod()            → Runtime modulus (dynamic R only) | Time: O(1)
+
+        Aliases:
+            StaticModInt<MOD>  = ModInt<StaticMontgomery<MOD>>   (fixed mod, chosen at compile time)
+            BarrettModInt      = ModInt<BarrettReducer>           (dynamic mod < 2^32)
+            MontgomeryModInt   = ModInt<MontgomeryReducer>        (dynamic odd mod < 2^63)
+
+        Usage Example:
+            using mint = StaticModInt<998244353>;
+            mint a = 3, b = a.pow(100) / 7;
+            BarrettModInt::setMod(m);  BarrettModInt c = 5;  cout << (c * c).val();
+            BIT_prodMod<long long, MontgomeryReducer> bit(arr, 1000000007);
+    */
+
+
+#ifndef MOD_REDUCERS_DEFINED
+#define MOD_REDUCERS_DEFINED
+    struct Int128Reducer {
+        uint64_t m;
+        explicit Int128Reducer(uint64_t mod = 1000000007ULL) : m(mod) {}
+        static bool supports(uint64_t mod) { return mod >= 1; }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const { return (uint64_t)((unsigned __int128)a * b % m); }
+    };
+
+    // q = floor(z / m) up to one, from the high half of z · ceil(2^64 / m)
+    struct BarrettReducer {
+        uint64_t m, im;
+        explicit BarrettReducer(uint64_t mod = 998244353ULL) : m(mod), im(~0ULL / mod + 1) {}
+        static bool supports(uint64_t mod) { return mod >= 1 && mod < (1ULL << 32); }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const {
+            uint64_t z = a * b;
+            uint64_t x = (uint64_t)(((unsigned __int128)z * im) >> 64);
+            uint64_t y = x * m;
+            return z - y + (z < y ? m : 0);
+        }
+    };
+
+    // Internal form a · 2^64 mod m; reduce(t) = t · 2^-64 mod m
+    struct MontgomeryReducer {
+        uint64_t m, inv, r2;
+        explicit MontgomeryReducer(uint64_t mod = 1000000007ULL) : m(mod), inv(1) {
+            for (int i = 0; i < 6; ++i) inv *= 2 - mod * inv;          // m^-1 mod 2^64 (Newton)
+            r2 = (uint64_t)(-(unsigned __int128)mod % mod);            // 2^128 mod m
+        }
+        static bool supports(uint64_t mod) { return (mod & 1) && mod < (1ULL << 63); }
+        uint64_t reduce(unsigned __int128 t) const {
+            uint64_t q = (uint64_t)t * inv;
+            uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * m) >> 64);
+            return a >= b ? a - b : a - b + m;
+        }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return to(1); }
+        uint64_t to(uint64_t x) const { return reduce((unsigned __int128)(x % m) * r2); }
+        uint64_t from(uint64_t a) const { return reduce(a); }
+        uint64_t mul(uint64_t a, uint64_t b) const { return reduce((unsigned __int128)a * b); }
+    };
+
+    // Montgomery with MOD known at compile time; MOD < 2^31 runs entirely in 64-bit registers
+    template <uint64_t MOD>
+    struct StaticMontgomery {
+        static_assert((MOD & 1) && MOD < (1ULL << 63), "StaticMontgomery: MOD must be odd and < 2^63");
+        static constexpr bool SMALL = MOD < (1ULL << 31);
+
+        static constexpr uint64_t inv64() { uint64_t x = 1; for (int i = 0; i < 6; ++i) x *= 2 - MOD * x; return x; }
+        static constexpr uint64_t INV = inv64();
+        // SMALL uses radix 2^32 (R2 = 2^64 mod MOD), otherwise radix 2^64 (R2 = 2^128 mod MOD)
+        static constexpr uint64_t R2 = SMALL ? (uint64_t)((((unsigned __int128)1) << 64) % MOD)
+                                             : (uint64_t)((-(unsigned __int128)MOD) % MOD);
+
+        explicit StaticMontgomery(uint64_t mod = MOD) {
+            if (mod != MOD) throw invalid_argument("StaticMontgomery: modulus differs from MOD");
+        }
+        static bool supports(uint64_t mod) { return mod == MOD; }
+
+        static uint64_t reduce(unsigned __int128 t) {
+            if constexpr (SMALL) {
+                uint64_t x = (uint64_t)t;
+                uint32_t q = (uint32_t)x * (uint32_t)(0 - INV);         // -MOD^-1 mod 2^32
+                uint64_t r = (x + (uint64_t)q * MOD) >> 32;
+                return r >= MOD ? r - MOD : r;
+            } else {
+                uint64_t q = (uint64_t)t * INV;
+                uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * MOD) >> 64);
+                return a >= b ? a - b : a - b + MOD;
+            }
+        }
+        static constexpr uint64_t mod() { return MOD; }
+        static uint64_t one() { return to(1); }
+        static uint64_t to(uint64_t x) { return reduce((unsigned __int128)(x % MOD) * R2); }
+        static uint64_t from(uint64_t a) { return reduce(a); }
+        static uint64_t mul(uint64_t a, uint64_t b) {
+            if constexpr (SMALL) return reduce(a * b);
+            else return reduce((unsigned __int128)a * b);
+        }
+    };
+#endif
+
+
+    template <typename R, int Tag = 0>
+    struct ModInt {
+    private:
+        static inline R red{};
+        uint64_t v = 0;              // internal form
+
+        static ModInt raw(uint64_t internal) { ModInt r; r.v = internal; return r; }
+
+    public:
+        ModInt() = default;
+
+        ModInt(long long x) {
+            long long m = (long long)red.mod();
+            x %= m;
+            if (x < 0) x += m;
+            v = red.to((uint64_t)x);
+        }
+
+        static void setMod(uint64_t m) {
+            if (!R::supports(m)) throw invalid_argument("ModInt::setMod - modulus not supported by this reducer");
+            red = R(m);
+        }
+        static uint64_t mod() { return red.mod(); }
+
+        uint64_t val() const { return red.from(v); }
+
+        ModInt& operator+=(const ModInt& o) { v += o.v; if (v >= red.mod()) v -= red.mod(); return *this; }
+        ModInt& operator-=(const ModInt& o) { v = v >= o.v ? v - o.v : v + red.mod() - o.v; return *this; }
+        ModInt& operator*=(const ModInt& o) { v = red.mul(v, o.v); return *this; }
+        ModInt& operator/=(const ModInt& o) { return *this *= o.inv(); }
+
+        friend ModInt operator+(ModInt a, const ModInt& b) { return a += b; }
+        friend ModInt operator-(ModInt a, const ModInt& b) { return a -= b; }
+        friend ModInt operator*(ModInt a, const ModInt& b) { return a *= b; }
+        friend ModInt operator/(ModInt a, const ModInt& b) { return a /= b; }
+        ModInt operator-() const { return raw(v == 0 ? 0 : red.mod() - v); }
+
+        friend bool operator==(const ModInt& a, const ModInt& b) { return a.v == b.v; }
+        friend bool operator!=(const ModInt& a, const ModInt& b) { return a.v != b.v; }
+
+        ModInt pow(unsigned long long e) const {
+            ModInt base = *this, res = raw(red.one());
+            while (e > 0) {
+                if (e & 1) res *= base;
+                base *= base;
+                e >>= 1;
+            }
+            return res;
+        }
+
+        // Fermat inverse: modulus must be prime
+        ModInt inv() const { return pow(red.mod() - 2); }
+
+        friend ostream& operator<<(ostream& os, const ModInt& a) { return os << a.val(); }
+    };
+
+    template <uint64_t MOD>
+    using StaticModInt = ModInt<StaticMontgomery<MOD>>;
+    using BarrettModInt = ModInt<BarrettReducer>;
+    using MontgomeryModInt = ModInt<MontgomeryReducer>;
+}
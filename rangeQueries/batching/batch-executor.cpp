@@ -0,0 +1,163 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        BatchExecutor — Offline Batched Range Queries
+        ===============================
+
+        Answers a batch of range queries against any range-query structure (SegTree1D,
+        BIT_1D, SparseTableGeneral, ...) through one uniform entry point. The batch is
+        reordered by (L, R) so that consecutive queries walk the same root-to-leaf paths /
+        table rows while they are still in cache; answers are scattered back to the
+        original positions. The structure is reached only through a user callable, so
+        the same code works for every structure in rangeQueries/.
+
+        1. queryBatch<Ans>(ds, queries, fn)            → Answers in original order       | Time: O(q log q + q · Q) | Space: O(q)
+        2. queryBatchParallel<Ans>(ds, queries, fn, t) → Same, sorted batch split over t threads
+                                                        | Time: O(q log q + q · Q / t) | Space: O(q)
+                                                        | fn receives `const DS&`: only structures with const
+                                                        | queries qualify (BIT_1D, SparseTableGeneral, WideSegTree);
+                                                        | SegTree1D pushes lazy tags while querying → use queryBatch
+                                                        | Ans must not be bool (vector<bool> writes race) → use char
+        3. applyBatch(ds, updates, fn)                 → Apply RangeUpdate{l, r, val} sorted by (l, r)
+                                                        | Time: O(u log u + u · U) | Space: O(u)
+                                                        | updates must commute (e.g. additions); order is not kept
+        4. sortedOrder(queries)                        → Index permutation used by all of the above | Time: O(q log q)
+
+        Where:
+            q, u = number of queries / updates
+            Q, U = cost of one query / update on the structure
+            fn   = callable (ds, l, r) -> Ans for queries, (ds, l, r, val) -> void for updates
+            t    = thread count (0 = hardware_concurrency)
+
+        Usage Example:
+            SegTree1D<long long> st(arr);
+            auto sums = BatchExecutor::queryBatch<long long>(st, qs,
+                [](SegTree1D<long long>& s, int l, int r) { return s.rangeSum(l, r); });
+
+            BIT_1D<long long> bit(arr);                     // 0-indexed input, 1-based internally
+            auto fast = BatchExecutor::queryBatchParallel<long long>(bit, qs,
+                [](const BIT_1D<long long>& b, int l, int r) { return b.getRangeQuery(l + 1, r + 1); });
+
+            SparseTableGeneral<int> sp(a);
+            auto mins = BatchExecutor::queryBatchParallel<int>(sp, qs,
+                [](const SparseTableGeneral<int>& s, int l, int r) { return s.query(l, r); }, 8);
+
+            BatchExecutor::applyBatch(st, adds,
+                [](SegTree1D<long long>& s, int l, int r, long long v) { s.rangeAdd(l, r, v); });
+    */
+
+
+#ifndef PARALLEL_HELPERS_DEFINED
+#define PARALLEL_HELPERS_DEFINED
+    // Worker count for a `threads` argument: 0 means hardware_concurrency, never below 1
+    inline int resolveThreads(int threads) {
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        return max(1, threads);
+    }
+
+    // Depth of the subtree frontier split among workers, ~4 subtrees per worker for balance
+    inline int frontierDepth(int threads) {
+        int d = 0;
+        while ((1 << d) < 4 * threads) ++d;
+        return d;
+    }
+
+    // Runs job(i) for i in [0, tasks) on `threads` workers, contiguous blocks per worker
+    template <typename Job>
+    void runParallel(int tasks, int threads, Job job) {
+        threads = min(threads, tasks);
+        if (threads <= 1) { for (int i = 0; i < tasks; ++i) job(i); return; }
+        vector<thread> pool;
+        pool.reserve(threads);
+        for (int t = 0; t < threads; ++t) {
+            int from = (int)((long long)tasks * t / threads);
+            int to = (int)((long long)tasks * (t + 1) / threads);
+            pool.emplace_back([from, to, &job]() { for (int i = from; i < to; ++i) job(i); });
+        }
+        for (auto& th : pool) th.join();
+    }
+#endif
+
+
+    template <typename T>
+    struct RangeUpdate {
+        int l, r;
+        T val;
+    };
+
+    class BatchExecutor {
+    private:
+        static inline uint64_t packKey(int l, int r) {
+            return ((uint64_t)(uint32_t)l << 32) | (uint32_t)r;
+        }
+
+    public:
+        // Permutation of [0, q) ordering the batch by (l, r)
+        static vector<int> sortedOrder(const vector<pair<int,int>>& queries) {
+            int q = (int)queries.size();
+            vector<pair<uint64_t,int>> keyed(q);
+            for (int i = 0; i < q; ++i) keyed[i] = {packKey(queries[i].first, queries[i].second), i};
+            sort(keyed.begin(), keyed.end());
+            vector<int> order(q);
+            for (int i = 0; i < q; ++i) order[i] = keyed[i].second;
+            return order;
+        }
+
+        template <typename Ans, typename DS, typename QueryFn>
+        static vector<Ans> queryBatch(DS& ds, const vector<pair<int,int>>& queries, QueryFn fn) {
+            vector<int> order = sortedOrder(queries);
+            vector<Ans> answers(queries.size());
+            for (int id : order) answers[id] = fn(ds, queries[id].first, queries[id].second);
+            return answers;
+        }
+
+        template <typename Ans, typename DS, typename QueryFn>
+        static vector<Ans> queryBatchParallel(const DS& ds, const vector<pair<int,int>>& queries,
+                                              QueryFn fn, int threads = 0) {
+            static_assert(!is_same_v<Ans, bool>, "queryBatchParallel: vector<bool> packs answers into shared words, use char");
+            vector<int> order = sortedOrder(queries);
+            vector<Ans> answers(queries.size());
+            int q = (int)queries.size();
+            threads = min(resolveThreads(threads), max(1, q));
+
+            // contiguous slices of the sorted order keep each worker's accesses local
+            auto work = [&](int from, int to) {
+                for (int i = from; i < to; ++i) {
+                    int id = order[i];
+                    answers[id] = fn(ds, queries[id].first, queries[id].second);
+                }
+            };
+            if (threads == 1) { work(0, q); return answers; }
+            vector<thread> pool;
+            pool.reserve(threads);
+            for (int t = 0; t < threads; ++t) {
+                int from = (int)((long long)q * t / threads);
+                int to = (int)((long long)q * (t + 1) / threads);
+                pool.emplace_back(work, from, to);
+            }
+            for (auto& th : pool) th.join();
+            return answers;
+        }
+
+        template <typename DS, typename T, typename ApplyFn>
+        static void applyBatch(DS& ds, const vector<RangeUpdate<T>>& updates, ApplyFn fn) {
+            int u = (int)updates.size();
+            vector<pair<uint64_t,int>> keyed(u);
+            for (int i = 0; i < u; ++i) keyed[i] = {packKey(updates[i].l, updates[i].r), i};
+            sort(keyed.begin(), keyed.end());
+            for (auto& kv : keyed) {
+                const RangeUpdate<T>& up = updates[kv.second];
+                fn(ds, up.l, up.r, up.val);
+            }
+        }
+    };
+}
@@ -0,0 +1,879 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+#include<sys/resource.h>
+#include<sys/wait.h>
+#include<unistd.h>
+using namespace __gnu_pbds;
+using namespace std;
+
+#include "../../maths/modint.cpp"
+#include "../fenwickTree/BIT_1D.cpp"
+#include "../fenwickTree/BIT_prodMod.cpp"
+#include "../segmentTree/segment-tree.cpp"
+#include "../segmentTree/segment-tree-iterative.cpp"
+#include "../segmentTree/segment-tree-policy.cpp"
+#include "../segmentTree/segment-tree-wide.cpp"
+#include "../segmentTree/segment-tree-adv.cpp"
+#include "../sparseTable/SparseTable.cpp"
+#include "../sparseTable/LinearRMQ.cpp"
+#include "../sqrtDcmp/basic-sqrt.cpp"
+#include "../sqrtDcmp/mos-sqrt.cpp"
+#include "../fenwickTree/BIT_1D_RU.cpp"
+#include "../fenwickTree/BIT_2D.cpp"
+#include "../fenwickTree/BIT_2D_Compressed.cpp"
+#include "../fenwickTree/BIT_ND.cpp"
+#include "../segmentTree/segment-tree-beats.cpp"
+#include "../segmentTree/segment-tree-dynamic.cpp"
+#include "../segmentTree/segment-tree-persistent.cpp"
+#include "../segmentTree/segment-tree-2D.cpp"
+#include "../segmentTree/segment-tree-adv-2D.cpp"
+#include "../sparseTable/SparseTable2D.cpp"
+#include "../sqrtDcmp/mos-upd.cpp"
+#include "../sqrtDcmp/mos-rollback.cpp"
+#include "../batching/batch-executor.cpp"
+#include "../waveletMatrix/wavelet-matrix.cpp"
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        Range-Query Benchmark Suite
+        ===============================
+
+        Reproducible benchmark for every structure under rangeQueries/. One workload
+        (array + operation stream) is generated from the seed and replayed against each
+        structure; every structure runs in its own forked process so that peak RSS is
+        reported per structure rather than for the whole run.
+
+        Build & run:
+            g++ -O3 -march=native -std=c++17 -pthread bench-range-queries.cpp -o bench
+            ./bench --n 1000000 --ops 1000000 --update-ratio 0.1 --dist zipf --format csv
+
+        Options:
+            --n N               array size                                  (default 1000000)
+            --ops Q             operations per run                          (default 1000000)
+            --update-ratio p    fraction of operations that are updates     (default 0.1)
+            --dist D            uniform | zipf | seq  (position of L)       (default uniform)
+            --zipf-s s          Zipf exponent for --dist zipf               (default 1.0)
+            --max-len K         range length drawn uniformly from [1, K]    (default n)
+            --ops-2d Q          rectangle operations for the 2D workload    (default ops / 10)
+            --reps R            repetitions, best run reported              (default 3)
+            --seed S            RNG seed                                    (default 12345)
+            --only a,b,c        run only the listed structures (names as in output)
+            --format F          csv | json                                  (default csv)
+
+        Output columns (one row per structure):
+            structure, n, ops, update_ratio, dist, build_ms, ns_per_op, ops_per_sec, peak_rss_kb, checksum, note
+
+        Semantics per structure:
+            updates = "add val to [L, R]" where supported, otherwise "add val at L";
+            static structures (SparseTableGeneral) and offline ones (MosAlgorithm) replay
+            only the queries of the stream, which is stated in the `note` column.
+            Product structures (BIT_prodMod, SegTreeAdv1D::rangeProdMod) run once per modular
+            backend (Int128 / Barrett / Montgomery / StaticMontgomery) on mod 1e9+7; their
+            checksums must agree, the ns/op column shows the cost of the modular multiply.
+            HandRMQ<Min> is a plain hand-written min sparse table (flat array, std::min,
+            no checks): the reference latency for SparseTableGeneral / SparseTableFlat.
+            LinearRMQ<Min> trades a little query latency for O(n) memory (see peak_rss_kb).
+            BatchExecutor<BIT_1D> batches each run of queries between two updates through
+            BatchExecutor::queryBatch; its checksum must equal BIT_1D's.
+            MosAlgorithmWithUpdates replays updates as "a[L] = val" (offline, distinct count);
+            it is O(n^(5/3)) and takes minutes at the default n, so pick it with --only or a
+            smaller --n. MosRollback answers the queries only (max frequency).
+
+        Static order statistics (queries of the same stream, updates skipped):
+            RangeOrderStats and WaveletMatrix return the median, kth(L, R, (R - L) / 2 + 1);
+            their checksums must agree.
+
+        2D workload (separate stream from the same seed, so 1D checksums do not move):
+            an S × S grid with S = ⌊√n⌋, --ops-2d rectangle operations with both sides drawn
+            from [1, min(K, S)] (K = --max-len) and the same update ratio; --dist is ignored.
+            updates = "add val to the rectangle" where supported (BIT_ND<2>, SegTree2D,
+            SegTree2DFlat; their checksums agree), "add val at the corner" for BIT_2D and
+            BIT_2D_Compressed (all S² cells registered, i.e. its dense worst case), and
+            "assign val + 1" with gcd queries for SegTreeAdv2D. SparseTable2D<Min> is static,
+            queries only, under a 256 MB budget. BIT_ND<2> has no bulk constructor, so its
+            build_ms is S² point adds. The n / ops columns still show the 1D config; the
+            note column gives S and the 2D op count.
+
+        Not benchmarked: the xor half of BIT_1D_RU (O(len) range update by design) and the
+        rangeLCM / rangeProdMod queries of SegTreeAdv2D (same traversal as rangeGCD).
+    */
+
+
+    namespace bench {
+
+        struct Config {
+            int n = 1000000;
+            int ops = 1000000;
+            double updateRatio = 0.1;
+            string dist = "uniform";
+            double zipfS = 1.0;
+            int maxLen = -1;
+            int ops2d = -1;
+            int reps = 3;
+            uint64_t seed = 12345;
+            string format = "csv";
+            set<string> only;
+        };
+
+        struct Op {
+            bool isUpdate;
+            int l, r;
+            long long val;
+        };
+
+        struct Op2D {
+            bool isUpdate;
+            int x1, y1, x2, y2;             // 0-based inclusive rectangle
+            long long val;
+        };
+
+        struct Workload {
+            vector<long long> arr;
+            vector<Op> ops;
+            int queryCount = 0;
+
+            int side = 0;                   // 2D grid is side × side
+            vector<vector<long long>> grid;
+            vector<Op2D> ops2d;
+            int queryCount2d = 0;
+        };
+
+        struct Result {
+            string name;
+            double buildMs = 0, nsPerOp = 0, opsPerSec = 0;
+            long peakRssKb = 0;
+            long long checksum = 0;
+            string note;
+        };
+
+        // Zipf sampler over [0, n) by inverse CDF on a precomputed table
+        class Zipf {
+            vector<double> cdf;
+        public:
+            Zipf(int n, double s) : cdf(n) {
+                double acc = 0;
+                for (int i = 0; i < n; ++i) { acc += 1.0 / pow(i + 1.0, s); cdf[i] = acc; }
+                for (double& x : cdf) x /= acc;
+            }
+            int operator()(mt19937_64& rng) const {
+                double u = uniform_real_distribution<double>(0.0, 1.0)(rng);
+                return int(lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin());
+            }
+        };
+
+        Workload makeWorkload(const Config& cfg) {
+            Workload w;
+            mt19937_64 rng(cfg.seed);
+            w.arr.resize(cfg.n);
+            for (auto& x : w.arr) x = (long long)(rng() % 1000);
+
+            int maxLen = cfg.maxLen > 0 ? min(cfg.maxLen, cfg.n) : cfg.n;
+            unique_ptr<Zipf> zipf;
+            vector<int> hot;   // zipf ranks mapped to scattered positions
+            if (cfg.dist == "zipf") {
+                zipf.reset(new Zipf(cfg.n, cfg.zipfS));
+                hot.resize(cfg.n);
+                iota(hot.begin(), hot.end(), 0);
+                shuffle(hot.begin(), hot.end(), rng);
+            }
+
+            w.ops.resize(cfg.ops);
+            for (int i = 0; i < cfg.ops; ++i) {
+                Op& op = w.ops[i];
+                op.isUpdate = uniform_real_distribution<double>(0.0, 1.0)(rng) < cfg.updateRatio;
+                int l;
+                if (cfg.dist == "zipf") l = hot[(*zipf)(rng)];
+                else if (cfg.dist == "seq") l = i % cfg.n;
+                else l = (int)(rng() % cfg.n);
+                int len = 1 + (int)(rng() % maxLen);
+                op.l = l;
+                op.r = min(cfg.n - 1, l + len - 1);
+                op.val = (long long)(rng() % 100);
+                if (!op.isUpdate) w.queryCount++;
+            }
+
+            // 2D stream from its own generator so that the 1D stream above is unchanged
+            mt19937_64 rng2(cfg.seed ^ 0x9E3779B97F4A7C15ULL);
+            int S = max(1, (int)sqrt((double)cfg.n));
+            int K = cfg.maxLen > 0 ? min(cfg.maxLen, S) : S;
+            w.side = S;
+            w.grid.assign(S, vector<long long>(S));
+            for (auto& row : w.grid) for (auto& x : row) x = (long long)(rng2() % 1000);
+            w.ops2d.resize(cfg.ops2d >= 0 ? cfg.ops2d : cfg.ops / 10);
+            for (Op2D& op : w.ops2d) {
+                op.isUpdate = uniform_real_distribution<double>(0.0, 1.0)(rng2) < cfg.updateRatio;
+                op.x1 = (int)(rng2() % S); op.y1 = (int)(rng2() % S);
+                op.x2 = min(S - 1, op.x1 + (int)(rng2() % K));
+                op.y2 = min(S - 1, op.y1 + (int)(rng2() % K));
+                op.val = (long long)(rng2() % 100);
+                if (!op.isUpdate) w.queryCount2d++;
+            }
+            return w;
+        }
+
+        inline double msSince(chrono::steady_clock::time_point t0) {
+            return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        }
+
+        long peakRssKb() {
+            struct rusage ru;
+            getrusage(RUSAGE_SELF, &ru);
+            return ru.ru_maxrss;   // kilobytes on Linux
+        }
+
+        // Runs build() once per rep and replay(structure) over the stream; best rep is kept
+        template <typename Build, typename Replay>
+        Result measure(const string& name, const Config& cfg, int countedOps, Build build, Replay replay, string note = "") {
+            Result res;
+            res.name = name;
+            res.note = note;
+            double bestBuild = 1e300, bestRun = 1e300;
+            for (int rep = 0; rep < max(1, cfg.reps); ++rep) {
+                auto t0 = chrono::steady_clock::now();
+                auto ds = build();
+                bestBuild = min(bestBuild, msSince(t0));
+                auto t1 = chrono::steady_clock::now();
+                res.checksum = replay(ds);
+                bestRun = min(bestRun, msSince(t1));
+            }
+            res.buildMs = bestBuild;
+            res.nsPerOp = countedOps ? bestRun * 1e6 / countedOps : 0;
+            res.opsPerSec = bestRun > 0 ? countedOps / (bestRun / 1000.0) : 0;
+            res.peakRssKb = peakRssKb();
+            return res;
+        }
+
+        using Runner = function<Result(const Config&, const Workload&)>;
+
+        // Reference min-RMQ as typically hand-written in a solution
+        struct HandRMQ {
+            int n, LOG;
+            vector<long long> t;
+            explicit HandRMQ(const vector<long long>& a) : n((int)a.size()), LOG(32 - __builtin_clz((unsigned)max(1, n))) {
+                t.assign((size_t)LOG * n, 0);
+                copy(a.begin(), a.end(), t.begin());
+                for (int k = 1; k < LOG; ++k)
+                    for (int i = 0; i + (1 << k) <= n; ++i)
+                        t[(size_t)k * n + i] = min(t[(size_t)(k - 1) * n + i], t[(size_t)(k - 1) * n + i + (1 << (k - 1))]);
+            }
+            long long query(int l, int r) const {
+                int k = 31 - __builtin_clz((unsigned)(r - l + 1));
+                return min(t[(size_t)k * n + l], t[(size_t)k * n + r - (1 << k) + 1]);
+            }
+        };
+
+        // threads = 0 → process(), otherwise processParallel(threads) (-1 = all cores)
+        Runner mosRunner(const string& name, MosOrder order, int threads = 0) {
+            return [name, order, threads](const Config& cfg, const Workload& w) {
+                vector<int> vals(w.arr.begin(), w.arr.end());
+                return measure(name, cfg, w.queryCount,
+                    [&] {
+                        auto mos = make_unique<MosAlgorithm<int>>(vals, order);
+                        int id = 0;
+                        for (const Op& op : w.ops) if (!op.isUpdate) mos->addQuery(op.l, op.r, id++);
+                        return mos;
+                    },
+                    [&](unique_ptr<MosAlgorithm<int>>& mos) {
+                        long long cs = 0;
+                        vector<long long> ans = threads == 0 ? mos->process() : mos->processParallel(max(0, threads));
+                        for (long long x : ans) cs += x;
+                        return cs;
+                    }, threads == 0 ? "offline: queries only; distinct count"
+                                    : "offline: queries only; distinct count; all cores");
+            };
+        }
+
+        string note2D(const Workload& w, const string& what) {
+            return "2D " + to_string(w.side) + "x" + to_string(w.side) + " grid; "
+                 + to_string(w.ops2d.size()) + " rect ops; " + what;
+        }
+
+        static constexpr long long PROD_MOD = 1000000007LL;
+
+        template <typename R>
+        Runner prodModBIT(const string& name) {
+            return [name](const Config& cfg, const Workload& w) {
+                return measure(name, cfg, cfg.ops,
+                    [&] { return BIT_prodMod<long long, R>(w.arr, PROD_MOD); },
+                    [&](BIT_prodMod<long long, R>& b) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) b.pointUpdate(op.l + 1, op.val + 1);
+                            else cs ^= b.rangeQuery(op.l + 1, op.r + 1);
+                        }
+                        return cs;
+                    }, "point set at L; product mod 1e9+7");
+            };
+        }
+
+        template <typename R>
+        Runner prodModSegAdv(const string& name) {
+            return [name](const Config& cfg, const Workload& w) {
+                return measure(name, cfg, cfg.ops,
+                    [&] { return SegTreeAdv1D<long long, R>(w.arr, PROD_MOD); },
+                    [&](SegTreeAdv1D<long long, R>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeAssign(op.l, op.r, op.val + 1);
+                            else cs ^= s.rangeProdMod(op.l, op.r, PROD_MOD);
+                        }
+                        return cs;
+                    }, "range assign; product mod 1e9+7");
+            };
+        }
+
+        vector<pair<string, Runner>> registry() {
+            vector<pair<string, Runner>> r;
+
+            r.push_back({"BIT_1D", [](const Config& cfg, const Workload& w) {
+                return measure("BIT_1D", cfg, cfg.ops,
+                    [&] { return BIT_1D<long long>(w.arr); },
+                    [&](BIT_1D<long long>& b) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) b.updatePoint(op.l + 1, op.val);
+                            else cs += b.getRangeQuery(op.l + 1, op.r + 1);
+                        }
+                        return cs;
+                    }, "point add at L");
+            }});
+
+            r.push_back({"SegTree1D", [](const Config& cfg, const Workload& w) {
+                return measure("SegTree1D", cfg, cfg.ops,
+                    [&] { return SegTree1D<long long>(w.arr); },
+                    [&](SegTree1D<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeAdd(op.l, op.r, op.val);
+                            else cs += s.rangeSum(op.l, op.r);
+                        }
+                        return cs;
+                    });
+            }});
+
+            r.push_back({"SegTree1DIter", [](const Config& cfg, const Workload& w) {
+                return measure("SegTree1DIter", cfg, cfg.ops,
+                    [&] { return SegTree1DIter<long long>(w.arr); },
+                    [&](SegTree1DIter<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeAdd(op.l, op.r, op.val);
+                            else cs += s.rangeSum(op.l, op.r);
+                        }
+                        return cs;
+                    });
+            }});
+
+            r.push_back({"SegTreeLazy<SumAdd>", [](const Config& cfg, const Workload& w) {
+                return measure("SegTreeLazy<SumAdd>", cfg, cfg.ops,
+                    [&] { return SegTreeLazy<SumAddPolicy<long long>>(w.arr); },
+                    [&](SegTreeLazy<SumAddPolicy<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeApply(op.l, op.r, op.val);
+                            else cs += s.rangeQuery(op.l, op.r);
+                        }
+                        return cs;
+                    });
+            }});
+
+            r.push_back({"WideSegTree<Sum>", [](const Config& cfg, const Workload& w) {
+                return measure("WideSegTree<Sum>", cfg, cfg.ops,
+                    [&] { return WideSegTree<long long, WideSum<long long>>(w.arr); },
+                    [&](WideSegTree<long long, WideSum<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.pointAdd(op.l, op.val);
+                            else cs += s.query(op.l, op.r);
+                        }
+                        return cs;
+                    }, "point add at L");
+            }});
+
+            r.push_back({"WideSegTree<Min>", [](const Config& cfg, const Workload& w) {
+                return measure("WideSegTree<Min>", cfg, cfg.ops,
+                    [&] { return WideSegTree<long long, WideMin<long long>>(w.arr); },
+                    [&](WideSegTree<long long, WideMin<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.pointSet(op.l, op.val);
+                            else cs += s.query(op.l, op.r);
+                        }
+                        return cs;
+                    }, "point set at L; min query");
+            }});
+
+            r.push_back({"SparseTableGeneral<Min>", [](const Config& cfg, const Workload& w) {
+                return measure("SparseTableGeneral<Min>", cfg, w.queryCount,
+                    [&] { return SparseTableGeneral<long long>(w.arr); },
+                    [&](SparseTableGeneral<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) if (!op.isUpdate) cs += s.query(op.l, op.r);
+                        return cs;
+                    }, "static: queries only; min query");
+            }});
+
+            r.push_back({"SparseTableFlat<Min>", [](const Config& cfg, const Workload& w) {
+                return measure("SparseTableFlat<Min>", cfg, w.queryCount,
+                    [&] { return SparseTableFlat<long long>(w.arr); },
+                    [&](SparseTableFlat<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) if (!op.isUpdate) cs += s.query(op.l, op.r);
+                        return cs;
+                    }, "static: queries only; min query");
+            }});
+
+            r.push_back({"HandRMQ<Min>", [](const Config& cfg, const Workload& w) {
+                return measure("HandRMQ<Min>", cfg, w.queryCount,
+                    [&] { return HandRMQ(w.arr); },
+                    [&](HandRMQ& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) if (!op.isUpdate) cs += s.query(op.l, op.r);
+                        return cs;
+                    }, "static: queries only; min query; reference");
+            }});
+
+            r.push_back({"LinearRMQ<Min>", [](const Config& cfg, const Workload& w) {
+                return measure("LinearRMQ<Min>", cfg, w.queryCount,
+                    [&] { return LinearRMQ<long long>(w.arr); },
+                    [&](LinearRMQ<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) if (!op.isUpdate) cs += s.query(op.l, op.r);
+                        return cs;
+                    }, "static: queries only; min query; O(n) memory");
+            }});
+
+            r.push_back({"SqrtDecomposition", [](const Config& cfg, const Workload& w) {
+                return measure("SqrtDecomposition", cfg, cfg.ops,
+                    [&] { return SqrtDecomposition<long long>(w.arr,
+                              [](const long long& a, const long long& b) { return a + b; }, 0LL, true); },
+                    [&](SqrtDecomposition<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeAdd(op.l, op.r, op.val);
+                            else cs += s.query(op.l, op.r);
+                        }
+                        return cs;
+                    });
+            }});
+
+            r.push_back({"SqrtDecompositionLazy<SumAdd>", [](const Config& cfg, const Workload& w) {
+                return measure("SqrtDecompositionLazy<SumAdd>", cfg, cfg.ops,
+                    [&] { return SqrtDecompositionLazy<SumAddPolicy<long long>>(w.arr); },
+                    [&](SqrtDecompositionLazy<SumAddPolicy<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeApply(op.l, op.r, op.val);
+                            else cs += s.rangeQuery(op.l, op.r);
+                        }
+                        return cs;
+                    });
+            }});
+
+            r.push_back({"SqrtDecompositionLazy<SumAdd>+calibrate", [](const Config& cfg, const Workload& w) {
+                int chosen = 0;
+                Result res = measure("SqrtDecompositionLazy<SumAdd>+calibrate", cfg, cfg.ops,
+                    [&] {
+                        // calibrate on the head of the real stream, as a caller would on logged ops
+                        vector<pair<int, int>> qs, us;
+                        for (int i = 0; i < (int)w.ops.size() && i < 2000; ++i)
+                            (w.ops[i].isUpdate ? us : qs).push_back({w.ops[i].l, w.ops[i].r});
+                        SqrtDecompositionLazy<SumAddPolicy<long long>> s(w.arr);
+                        chosen = s.calibrate(qs, us);
+                        return s;
+                    },
+                    [&](SqrtDecompositionLazy<SumAddPolicy<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeApply(op.l, op.r, op.val);
+                            else cs += s.rangeQuery(op.l, op.r);
+                        }
+                        return cs;
+                    });
+                res.note = "calibrated B = " + to_string(chosen) + " on the first 2000 ops; build_ms includes calibration";
+                return res;
+            }});
+
+            r.push_back({"MosAlgorithm", mosRunner("MosAlgorithm", MosOrder::BLOCK)});
+            r.push_back({"MosAlgorithm<Hilbert>", mosRunner("MosAlgorithm<Hilbert>", MosOrder::HILBERT)});
+            r.push_back({"MosAlgorithmParallel<Hilbert>", mosRunner("MosAlgorithmParallel<Hilbert>", MosOrder::HILBERT, -1)});
+
+            r.push_back({"BIT_prodMod<Int128>", prodModBIT<Int128Reducer>("BIT_prodMod<Int128>")});
+            r.push_back({"BIT_prodMod<Barrett>", prodModBIT<BarrettReducer>("BIT_prodMod<Barrett>")});
+            r.push_back({"BIT_prodMod<Montgomery>", prodModBIT<MontgomeryReducer>("BIT_prodMod<Montgomery>")});
+            r.push_back({"BIT_prodMod<StaticMontgomery>", prodModBIT<StaticMontgomery<PROD_MOD>>("BIT_prodMod<StaticMontgomery>")});
+            r.push_back({"SegTreeAdv1D<Int128>", prodModSegAdv<Int128Reducer>("SegTreeAdv1D<Int128>")});
+            r.push_back({"SegTreeAdv1D<Barrett>", prodModSegAdv<BarrettReducer>("SegTreeAdv1D<Barrett>")});
+            r.push_back({"SegTreeAdv1D<Montgomery>", prodModSegAdv<MontgomeryReducer>("SegTreeAdv1D<Montgomery>")});
+            r.push_back({"SegTreeAdv1D<StaticMontgomery>", prodModSegAdv<StaticMontgomery<PROD_MOD>>("SegTreeAdv1D<StaticMontgomery>")});
+
+            r.push_back({"BIT_1D_RU", [](const Config& cfg, const Workload& w) {
+                return measure("BIT_1D_RU", cfg, cfg.ops,
+                    [&] {
+                        BIT_1D_RU<long long, plusOp<long long>> b(cfg.n);
+                        for (int i = 0; i < cfg.n; ++i) b.sumPointUpdate(i, w.arr[i]);
+                        return b;
+                    },
+                    [&](BIT_1D_RU<long long, plusOp<long long>>& b) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) b.sumRangeUpdate(op.l, op.r, op.val);
+                            else cs += b.sumRangeQuery(op.l, op.r);
+                        }
+                        return cs;
+                    }, "build = n point adds");
+            }});
+
+            r.push_back({"SegTreeBeats", [](const Config& cfg, const Workload& w) {
+                return measure("SegTreeBeats", cfg, cfg.ops,
+                    [&] { return SegTreeBeats<long long>(w.arr); },
+                    [&](SegTreeBeats<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s.rangeAdd(op.l, op.r, op.val);
+                            else cs += s.rangeSum(op.l, op.r);
+                        }
+                        return cs;
+                    });
+            }});
+
+            r.push_back({"DynamicSegTree", [](const Config& cfg, const Workload& w) {
+                return measure("DynamicSegTree", cfg, cfg.ops,
+                    [&] {
+                        auto s = make_unique<DynamicSegTree<long long>>(cfg.n);
+                        s->reserve(4 * (size_t)cfg.n);
+                        for (int i = 0; i < cfg.n; ++i) s->pointAssign(i, w.arr[i]);
+                        return s;
+                    },
+                    [&](unique_ptr<DynamicSegTree<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) s->rangeAdd(op.l, op.r, op.val);
+                            else cs += s->rangeSum(op.l, op.r);
+                        }
+                        return cs;
+                    }, "U = n; build = n point assigns");
+            }});
+
+            r.push_back({"PersistentSegTree", [](const Config& cfg, const Workload& w) {
+                int depth = 32 - __builtin_clz((unsigned)cfg.n) + 1;
+                size_t updates = w.ops.size() - w.queryCount;
+                return measure("PersistentSegTree", cfg, cfg.ops,
+                    [&] { return PersistentSegTree<long long>(w.arr, 2 * (size_t)cfg.n + updates * depth); },
+                    [&](PersistentSegTree<long long>& s) {
+                        long long cs = 0;
+                        int ver = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) ver = s.pointAdd(ver, op.l, op.val);
+                            else cs += s.rangeSum(ver, op.l, op.r);
+                        }
+                        return cs;
+                    }, "point add at L; one new version per update");
+            }});
+
+            r.push_back({"BatchExecutor<BIT_1D>", [](const Config& cfg, const Workload& w) {
+                return measure("BatchExecutor<BIT_1D>", cfg, cfg.ops,
+                    [&] { return BIT_1D<long long>(w.arr); },
+                    [&](BIT_1D<long long>& b) {
+                        long long cs = 0;
+                        vector<pair<int, int>> batch;
+                        auto flush = [&] {
+                            if (batch.empty()) return;
+                            auto ans = BatchExecutor::queryBatch<long long>(b, batch,
+                                [](BIT_1D<long long>& t, int l, int r) { return t.getRangeQuery(l + 1, r + 1); });
+                            for (long long x : ans) cs += x;
+                            batch.clear();
+                        };
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) { flush(); b.updatePoint(op.l + 1, op.val); }
+                            else batch.push_back({op.l, op.r});
+                        }
+                        flush();
+                        return cs;
+                    }, "point add at L; query runs between updates batched");
+            }});
+
+            r.push_back({"MosAlgorithmWithUpdates", [](const Config& cfg, const Workload& w) {
+                vector<int> vals(w.arr.begin(), w.arr.end());
+                return measure("MosAlgorithmWithUpdates", cfg, cfg.ops,
+                    [&] {
+                        auto mos = make_unique<MosAlgorithmWithUpdates<int>>(vals);
+                        int id = 0;
+                        for (const Op& op : w.ops) {
+                            if (op.isUpdate) mos->addUpdate(op.l, (int)op.val);
+                            else mos->addQuery(op.l, op.r, id++);
+                        }
+                        return mos;
+                    },
+                    [&](unique_ptr<MosAlgorithmWithUpdates<int>>& mos) {
+                        long long cs = 0;
+                        for (long long x : mos->process()) cs += x;
+                        return cs;
+                    }, "offline: point assign at L; distinct count");
+            }});
+
+            r.push_back({"MosRollback", [](const Config& cfg, const Workload& w) {
+                vector<int> vals(w.arr.begin(), w.arr.end());
+                return measure("MosRollback", cfg, w.queryCount,
+                    [&] {
+                        auto mos = make_unique<MosRollback<int>>(vals);
+                        int id = 0;
+                        for (const Op& op : w.ops) if (!op.isUpdate) mos->addQuery(op.l, op.r, id++);
+                        return mos;
+                    },
+                    [&](unique_ptr<MosRollback<int>>& mos) {
+                        long long cs = 0;
+                        for (long long x : mos->process()) cs += x;
+                        return cs;
+                    }, "offline: queries only; max frequency");
+            }});
+
+            r.push_back({"RangeOrderStats", [](const Config& cfg, const Workload& w) {
+                return measure("RangeOrderStats", cfg, w.queryCount,
+                    [&] { return RangeOrderStats<long long>(w.arr); },
+                    [&](RangeOrderStats<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops)
+                            if (!op.isUpdate) cs += s.kthSmallest(op.l, op.r, (op.r - op.l) / 2 + 1);
+                        return cs;
+                    }, "static: queries only; range median");
+            }});
+
+            r.push_back({"WaveletMatrix", [](const Config& cfg, const Workload& w) {
+                return measure("WaveletMatrix", cfg, w.queryCount,
+                    [&] {
+                        vector<long long> vals(w.arr);
+                        sort(vals.begin(), vals.end());
+                        vals.erase(unique(vals.begin(), vals.end()), vals.end());
+                        vector<int> comp(w.arr.size());
+                        for (size_t i = 0; i < comp.size(); ++i)
+                            comp[i] = int(lower_bound(vals.begin(), vals.end(), w.arr[i]) - vals.begin());
+                        return WaveletMatrix<long long>(comp, vals);
+                    },
+                    [&](WaveletMatrix<long long>& s) {
+                        long long cs = 0;
+                        for (const Op& op : w.ops)
+                            if (!op.isUpdate) cs += s.kth(op.l, op.r, (op.r - op.l) / 2 + 1);
+                        return cs;
+                    }, "static: queries only; range median");
+            }});
+
+            // --- 2D workload ---
+            r.push_back({"BIT_2D", [](const Config& cfg, const Workload& w) {
+                return measure("BIT_2D", cfg, (int)w.ops2d.size(),
+                    [&] { return BIT_2D<long long>(w.grid); },
+                    [&](BIT_2D<long long>& b) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) {
+                            if (op.isUpdate) b.update(op.x1 + 1, op.y1 + 1, op.val);
+                            else cs += b.rangeSum(op.x1 + 1, op.y1 + 1, op.x2 + 1, op.y2 + 1);
+                        }
+                        return cs;
+                    }, note2D(w, "point add at corner"));
+            }});
+
+            r.push_back({"BIT_2D_Compressed", [](const Config& cfg, const Workload& w) {
+                return measure("BIT_2D_Compressed", cfg, (int)w.ops2d.size(),
+                    [&] {
+                        vector<pair<int, int>> pts;
+                        pts.reserve((size_t)w.side * w.side);
+                        for (int x = 0; x < w.side; ++x) for (int y = 0; y < w.side; ++y) pts.push_back({x, y});
+                        auto b = make_unique<BIT_2D_Compressed<long long, int>>(move(pts));
+                        for (int x = 0; x < w.side; ++x) for (int y = 0; y < w.side; ++y) b->update(x, y, w.grid[x][y]);
+                        return b;
+                    },
+                    [&](unique_ptr<BIT_2D_Compressed<long long, int>>& b) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) {
+                            if (op.isUpdate) b->update(op.x1, op.y1, op.val);
+                            else cs += b->rangeSum(op.x1, op.y1, op.x2, op.y2);
+                        }
+                        return cs;
+                    }, note2D(w, "point add at corner; every cell registered"));
+            }});
+
+            r.push_back({"BIT_ND<2>", [](const Config& cfg, const Workload& w) {
+                return measure("BIT_ND<2>", cfg, (int)w.ops2d.size(),
+                    [&] {
+                        auto b = make_unique<BIT_ND<long long, 2>>(array<int, 2>{w.side, w.side});
+                        for (int x = 0; x < w.side; ++x)
+                            for (int y = 0; y < w.side; ++y) b->pointAdd({x + 1, y + 1}, w.grid[x][y]);
+                        return b;
+                    },
+                    [&](unique_ptr<BIT_ND<long long, 2>>& b) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) {
+                            if (op.isUpdate) b->rangeAdd({op.x1 + 1, op.y1 + 1}, {op.x2 + 1, op.y2 + 1}, op.val);
+                            else cs += b->rangeSum({op.x1 + 1, op.y1 + 1}, {op.x2 + 1, op.y2 + 1});
+                        }
+                        return cs;
+                    }, note2D(w, "rect add; build = S^2 point adds"));
+            }});
+
+            r.push_back({"SegTree2D", [](const Config& cfg, const Workload& w) {
+                return measure("SegTree2D", cfg, (int)w.ops2d.size(),
+                    [&] { return make_unique<SegTree2D<long long>>(w.grid); },
+                    [&](unique_ptr<SegTree2D<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) {
+                            if (op.isUpdate) s->update_add(op.x1, op.y1, op.x2, op.y2, op.val);
+                            else cs += s->query_sum(op.x1, op.y1, op.x2, op.y2);
+                        }
+                        return cs;
+                    }, note2D(w, "rect add"));
+            }});
+
+            r.push_back({"SegTree2DFlat", [](const Config& cfg, const Workload& w) {
+                return measure("SegTree2DFlat", cfg, (int)w.ops2d.size(),
+                    [&] { return make_unique<SegTree2DFlat<long long>>(w.grid); },
+                    [&](unique_ptr<SegTree2DFlat<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) {
+                            if (op.isUpdate) s->update_add(op.x1, op.y1, op.x2, op.y2, op.val);
+                            else cs += s->query_sum(op.x1, op.y1, op.x2, op.y2);
+                        }
+                        return cs;
+                    }, note2D(w, "rect add"));
+            }});
+
+            r.push_back({"SegTreeAdv2D", [](const Config& cfg, const Workload& w) {
+                return measure("SegTreeAdv2D", cfg, (int)w.ops2d.size(),
+                    [&] { return make_unique<SegTreeAdv2D<long long>>(w.grid); },
+                    [&](unique_ptr<SegTreeAdv2D<long long>>& s) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) {
+                            if (op.isUpdate) s->rangeAssign(op.x1, op.y1, op.x2, op.y2, op.val + 1);
+                            else cs += s->rangeGCD(op.x1, op.y1, op.x2, op.y2);
+                        }
+                        return cs;
+                    }, note2D(w, "rect assign val + 1; gcd query"));
+            }});
+
+            r.push_back({"SparseTable2D<Min>", [](const Config& cfg, const Workload& w) {
+                return measure("SparseTable2D<Min>", cfg, w.queryCount2d,
+                    [&] { return SparseTable2D<long long>(w.grid, (size_t)256 << 20); },
+                    [&](SparseTable2D<long long>& s) {
+                        long long cs = 0;
+                        for (const Op2D& op : w.ops2d) if (!op.isUpdate) cs += s.query(op.x1, op.y1, op.x2, op.y2);
+                        return cs;
+                    }, note2D(w, "static: queries only; min query; 256 MB budget"));
+            }});
+
+            return r;
+        }
+
+        // Runs one structure in a child process (fresh peak RSS), result comes back over a pipe
+        Result runIsolated(const Runner& run, const Config& cfg, const Workload& w, const string& name) {
+            int fd[2];
+            if (pipe(fd) != 0) return run(cfg, w);
+            pid_t pid = fork();
+            if (pid < 0) { close(fd[0]); close(fd[1]); return run(cfg, w); }
+            if (pid == 0) {
+                close(fd[0]);
+                Result r = run(cfg, w);
+                ostringstream os;
+                os << setprecision(17) << r.buildMs << ' ' << r.nsPerOp << ' ' << r.opsPerSec << ' '
+                   << r.peakRssKb << ' ' << r.checksum << '\n' << r.note;
+                string s = os.str();
+                ssize_t written = write(fd[1], s.data(), s.size());
+                (void)written;
+                close(fd[1]);
+                _exit(0);
+            }
+            close(fd[1]);
+            string data;
+            char buf[4096];
+            ssize_t k;
+            while ((k = read(fd[0], buf, sizeof(buf))) > 0) data.append(buf, k);
+            close(fd[0]);
+            waitpid(pid, nullptr, 0);
+            Result r;
+            r.name = name;
+            istringstream is(data);
+            if (!(is >> r.buildMs >> r.nsPerOp >> r.opsPerSec >> r.peakRssKb >> r.checksum)) {
+                r.note = "crashed";
+                return r;
+            }
+            is.ignore(1);
+            getline(is, r.note);
+            return r;
+        }
+
+        void printCsvHeader() {
+            cout << "structure,n,ops,update_ratio,dist,build_ms,ns_per_op,ops_per_sec,peak_rss_kb,checksum,note\n";
+        }
+
+        void printCsv(const Config& cfg, const Result& r) {
+            cout << fixed << setprecision(3)
+                 << r.name << ',' << cfg.n << ',' << cfg.ops << ',' << cfg.updateRatio << ',' << cfg.dist << ','
+                 << r.buildMs << ',' << r.nsPerOp << ',' << setprecision(0) << r.opsPerSec << ','
+                 << r.peakRssKb << ',' << r.checksum << ",\"" << r.note << "\"\n";
+        }
+
+        void printJson(const Config& cfg, const vector<Result>& rs) {
+            cout << fixed << "{\n  \"config\": {\"n\": " << cfg.n << ", \"ops\": " << cfg.ops
+                 << ", \"update_ratio\": " << setprecision(3) << cfg.updateRatio << ", \"dist\": \"" << cfg.dist
+                 << "\", \"seed\": " << cfg.seed << ", \"reps\": " << cfg.reps << "},\n  \"results\": [\n";
+            for (size_t i = 0; i < rs.size(); ++i) {
+                const Result& r = rs[i];
+                cout << "    {\"structure\": \"" << r.name << "\", \"build_ms\": " << setprecision(3) << r.buildMs
+                     << ", \"ns_per_op\": " << r.nsPerOp << ", \"ops_per_sec\": " << setprecision(0) << r.opsPerSec
+                     << ", \"peak_rss_kb\": " << r.peakRssKb << ", \"checksum\": " << r.checksum
+                     << ", \"note\": \"" << r.note << "\"}" << (i + 1 < rs.size() ? "," : "") << "\n";
+            }
+            cout << "  ]\n}\n";
+        }
+
+        Config parseArgs(int argc, char** argv) {
+            Config cfg;
+            for (int i = 1; i < argc; ++i) {
+                string key = argv[i];
+                auto next = [&]() -> string {
+                    if (i + 1 >= argc) { cerr << "missing value for " << key << "\n"; exit(1); }
+                    return argv[++i];
+                };
+                if (key == "--n") cfg.n = stoi(next());
+                else if (key == "--ops") cfg.ops = stoi(next());
+                else if (key == "--update-ratio") cfg.updateRatio = stod(next());
+                else if (key == "--dist") cfg.dist = next();
+                else if (key == "--zipf-s") cfg.zipfS = stod(next());
+                else if (key == "--max-len") cfg.maxLen = stoi(next());
+                else if (key == "--ops-2d") cfg.ops2d = stoi(next());
+                else if (key == "--reps") cfg.reps = stoi(next());
+                else if (key == "--seed") cfg.seed = stoull(next());
+                else if (key == "--format") cfg.format = next();
+                else if (key == "--only") {
+                    string list = next(), item;
+                    stringstream ss(list);
+                    while (getline(ss, item, ',')) cfg.only.insert(item);
+                } else { cerr << "unknown option " << key << "\n"; exit(1); }
+            }
+            if (cfg.n <= 0 || cfg.ops < 0) { cerr << "--n must be > 0 and --ops >= 0\n"; exit(1); }
+            if (cfg.dist != "uniform" && cfg.dist != "zipf" && cfg.dist != "seq") { cerr << "bad --dist\n"; exit(1); }
+            return cfg;
+        }
+    }
+}
+
+
+int main(int argc, char** argv) {
+    using namespace bench;
+    Config cfg = parseArgs(argc, argv);
+    Workload w = makeWorkload(cfg);
+
+    vector<Result> results;
+    if (cfg.format == "csv") printCsvHeader();
+    for (auto& [name, run] : registry()) {
+        if (!cfg.only.empty() && !cfg.only.count(name)) continue;
+        Result r = runIsolated(run, cfg, w, name);
+        if (cfg.format == "csv") { printCsv(cfg, r); cout.flush(); }
+        results.push_back(r);
+    }
+    if (cfg.format == "json") printJson(cfg, results);
+    return 0;
+}
@@ -16,35 +16,99 @@ inline namespace MY{
         1. BIT_1D(size, oneIndexed)         → Constructor | Time: O(n)  | Space: O(n)
         2. BIT_1D(array, oneIndexed)        → Constructor | Time: O(n)  | Space: O(n)
         3. getPrefixSum(i)                  → Prefix query [1, i] | Time: O(log n) | Space: O(1)
-        4. getRangeQuery(l, r)              → Range query [l, r]  | Time: O(log n) | Space: O(1)
+        4. getRangeQuery(l, r)              → Range query [l, r]  | Time: O(log n) | Space: O(1) (groups only)
         5. updatePoint(i, delta)            → Point update [i]    | Time: O(log n) | Space: O(1)
-        6. setValue(i, newValue)            → Set value at index i| Time: O(log n) | Space: O(1)
-        7. lowerBound(k)                     → Smallest index s.t. prefix sum >= k | Time: O(log n) | Space: O(1) (sum BIT only)
-        8. upperBound(k)                     → Smallest index s.t. prefix sum > k | Time: O(log n) | Space: O(1) (sum BIT only)
+        6. setValue(i, newValue)            → Set value at index i| Time: O(log n) | Space: O(1) (groups only)
+        7. lowerBound(k)                     → Smallest index s.t. prefix >= k | Time: O(log n) | Space: O(1) (monotone ops only)
+        8. upperBound(k)                     → Smallest index s.t. prefix > k  | Time: O(log n) | Space: O(1) (monotone ops only)
         9. printArray()                      → Print original array | Time: O(n) | Space: O(1)
         10. printBIT()                       → Print BIT array      | Time: O(n) | Space: O(1)
         11. printPrefixSums()                → Print prefix sums [1, n] | Time: O(n log n) | Space: O(1)
-        12. isXorBIT()                       → Check if XOR BIT     | Time: O(1) | Space: O(1)
+        12. isXorBIT()                       → Check if XOR BIT     | Time: O(1) | Space: O(1) (constexpr)
+
+        Op concept (checked at compile time, every call is a direct inlinable call):
+            T operator()(a, b)           → associative combine
+            T identity()                 → neutral element (required)
+            T inverse(a)                 → group inverse (optional; enables getRangeQuery / setValue)
+            static constexpr bool monotone
+                                         → prefix values never decrease along the array
+                                           (enables lowerBound / upperBound; optional, default false)
+
+            Prefix queries and the array constructor keep left-to-right order, so a
+            non-commutative monoid (e.g. matrix product) works for getPrefixSum on a built
+            array; updatePoint appends delta after the existing value of each covering
+            node and therefore needs a commutative op.
+
+        Ready-made ops:
+            plusOp<T>          → a + b, inverse -a, monotone (assumes values >= 0 for bounds)
+            xorOp<T>           → a ^ b, inverse a
+            modPlusOp<T, MOD>  → (a + b) % MOD, inverse (MOD - a) % MOD
+            maxOp<T>           → max(a, b), monotone, prefix-only (no inverse)
+            minOp<T>           → min(a, b), prefix-only (no inverse)
 
         Where:
         n = size of the array / BIT
-        delta = update increment (sum) or XOR value (xor)
+        delta = update increment, combined into the element with op
         l, r = 1-based indices for range operations
         i = 1-based index for point operations
-        k = prefix sum threshold (sum BIT only)
+        k = prefix threshold (monotone ops only)
+
+        Usage Example:
+            BIT_1D<long long> sum(arr);                               // classic sum BIT
+            BIT_1D<long long, modPlusOp<long long, 998244353>> ms(arr);
+            BIT_1D<int, maxOp<int>> pmax(n);                          // prefix max, lowerBound = first index with a[i] >= k
     */
 
 
+#ifndef BIT_OPS_DEFINED
+#define BIT_OPS_DEFINED
     template <typename T>
     struct plusOp {
+        static constexpr bool monotone = true;
         T operator()(const T& a, const T& b) const { return a + b; }
+        T identity() const { return T(0); }
+        T inverse(const T& a) const { return -a; }
     };
 
     template <typename T>
     struct xorOp {
         T operator()(const T& a, const T& b) const { return a ^ b; }
+        T identity() const { return T(0); }
+        T inverse(const T& a) const { return a; }
+    };
+
+    template <typename T, T MOD>
+    struct modPlusOp {
+        T operator()(const T& a, const T& b) const { T s = a + b; return s >= MOD ? s - MOD : s; }
+        T identity() const { return T(0); }
+        T inverse(const T& a) const { return a == 0 ? T(0) : MOD - a; }
+    };
+
+    template <typename T>
+    struct maxOp {
+        static constexpr bool monotone = true;
+        T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+        T identity() const { return numeric_limits<T>::lowest(); }
     };
 
+    template <typename T>
+    struct minOp {
+        T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+        T identity() const { return numeric_limits<T>::max(); }
+    };
+
+    // Compile-time traits over an Op: inverse() present? monotone flag set?
+    template <typename Op, typename T, typename = void>
+    struct bitHasInverse : false_type {};
+    template <typename Op, typename T>
+    struct bitHasInverse<Op, T, void_t<decltype(declval<const Op&>().inverse(declval<const T&>()))>> : true_type {};
+
+    template <typename Op, typename = void>
+    struct bitIsMonotone : false_type {};
+    template <typename Op>
+    struct bitIsMonotone<Op, void_t<decltype(Op::monotone)>> : integral_constant<bool, Op::monotone> {};
+#endif
+
     template <typename T, typename Op = plusOp<T>>
     class BIT_1D {
     private:
@@ -53,19 +117,34 @@ inline namespace MY{
         int n;             
         int offset;        
         Op op;             
-        bool isXor;        
+
+        // Descent shared by lowerBound / upperBound: largest idx with !reached(prefix(idx))
+        template <typename Reached>
+        int descend(const T& k, Reached reached) const {
+            int idx = 0;
+            T acc = op.identity();
+            int bitMask = n > 1 ? 1 << (31 - __builtin_clz(n - 1)) : 0;
+            while (bitMask > 0) {
+                int nextIdx = idx + bitMask;
+                if (nextIdx < n) {
+                    T cand = op(acc, bit[nextIdx]);
+                    if (!reached(cand, k)) {
+                        acc = cand;
+                        idx = nextIdx;
+                    }
+                }
+                bitMask >>= 1;
+            }
+            return idx + 1;
+        }
 
     public:
         // Constructor: initialize empty BIT
         BIT_1D(int size, bool oneIndexed = false) {
             offset = oneIndexed ? 0 : 1;
             n = size + offset;
-            bit.assign(n, T(0));
-            arr.assign(size, T(0));
-
-            if (is_same<Op, xorOp<T>>::value) isXor = true;
-            else if (is_same<Op, plusOp<T>>::value) isXor = false;
-            else throw runtime_error("Only sum or XOR BIT supported");
+            bit.assign(n, op.identity());
+            arr.assign(size, op.identity());
         }
 
         // Constructor: build BIT from existing array
@@ -74,11 +153,7 @@ inline namespace MY{
             offset = oneIndexed ? 0 : 1;
             n = len + offset;
             arr.assign(a.begin(), a.end());
-            bit.assign(n, T(0));
-
-            if (is_same<Op, xorOp<T>>::value) isXor = true;
-            else if (is_same<Op, plusOp<T>>::value) isXor = false;
-            else throw runtime_error("Only sum or XOR BIT supported");
+            bit.assign(n, op.identity());
 
             for (int i = 1; i < n; i++) {
                 bit[i] = op(bit[i], a[i - offset]);
@@ -89,9 +164,9 @@ inline namespace MY{
 
         // Get prefix query [1, i]
         T getPrefixSum(int i) const {
-            T result = T(0);
+            T result = op.identity();
             while (i > 0) {
-                result = op(result, bit[i]);
+                result = op(bit[i], result);
                 i -= i & -i;
             }
             return result;
@@ -99,8 +174,8 @@ inline namespace MY{
 
         // Get range query [l, r]
         T getRangeQuery(int l, int r) const {
-            if (isXor) return getPrefixSum(r) ^ getPrefixSum(l - 1);
-            else return getPrefixSum(r) - getPrefixSum(l - 1);
+            static_assert(bitHasInverse<Op, T>::value, "BIT_1D::getRangeQuery requires Op::inverse (group)");
+            return op(op.inverse(getPrefixSum(l - 1)), getPrefixSum(r));
         }
 
         // Update a single point by delta
@@ -114,52 +189,26 @@ inline namespace MY{
 
         // Set the value of an element
         void setValue(int i, T newValue) {
-            if (!isXor) {
-                T delta = newValue - arr[i - offset];
-                if (delta != T(0)) updatePoint(i, delta);
-            } else {
-                T delta = newValue ^ arr[i - offset];
-                if (delta != T(0)) updatePoint(i, delta);
-            }
+            static_assert(bitHasInverse<Op, T>::value, "BIT_1D::setValue requires Op::inverse (group)");
+            T delta = op(op.inverse(arr[i - offset]), newValue);
+            updatePoint(i, delta);
             arr[i - offset] = newValue;
         }
 
-        // Lower bound for prefix sums (only for sum BIT)
-        // Returns the smallest index such that prefix sum >= k
+        // Lower bound for prefixes (monotone ops only)
+        // Returns the smallest index such that prefix >= k
         int lowerBound(T k) const {
-            if (isXor) throw runtime_error("lower_bound only valid for sum BIT");
-            if (k <= T(0)) return offset;
-
-            int idx = 0;
-            int bitMask = 1 << (31 - __builtin_clz(n - 1));
-            while (bitMask > 0) {
-                int nextIdx = idx + bitMask;
-                if (nextIdx < n && bit[nextIdx] < k) {
-                    k -= bit[nextIdx];
-                    idx = nextIdx;
-                }
-                bitMask >>= 1;
-            }
-            return idx + 1;
+            static_assert(bitIsMonotone<Op>::value, "BIT_1D::lowerBound requires a monotone Op");
+            if (!(op.identity() < k)) return offset;
+            return descend(k, [](const T& v, const T& x) { return !(v < x); });
         }
 
-        // Upper bound for prefix sums (only for sum BIT)
-        // Returns the smallest index such that prefix sum > k
+        // Upper bound for prefixes (monotone ops only)
+        // Returns the smallest index such that prefix > k
         int upperBound(T k) const {
-            if (isXor) throw runtime_error("upper_bound only valid for sum BIT");
-            if (k < T(0)) return offset;
-
-            int idx = 0;
-            int bitMask = 1 << (31 - __builtin_clz(n - 1));
-            while (bitMask > 0) {
-                int nextIdx = idx + bitMask;
-                if (nextIdx < n && bit[nextIdx] <= k) {
-                    k -= bit[nextIdx];
-                    idx = nextIdx;
-                }
-                bitMask >>= 1;
-            }
-            return idx + 1;
+            static_assert(bitIsMonotone<Op>::value, "BIT_1D::upperBound requires a monotone Op");
+            if (k < op.identity()) return offset;
+            return descend(k, [](const T& v, const T& x) { return x < v; });
         }
 
         // Print the original array
@@ -181,6 +230,6 @@ inline namespace MY{
         }
 
         // Check if this BIT is XOR-based
-        bool isXorBIT() const { return isXor; }
+        static constexpr bool isXorBIT() { return is_same<Op, xorOp<T>>::value; }
     };
 }
\ No newline at end of file
@@ -29,8 +29,54 @@ inline namespace MY{
     */
 
 
-    template <typename T> struct plusOp { T operator()(T a, T b) const { return a + b; } };
-    template <typename T> struct xorOp  { T operator()(T a, T b) const { return a ^ b; } };
+#ifndef BIT_OPS_DEFINED
+#define BIT_OPS_DEFINED
+    template <typename T>
+    struct plusOp {
+        static constexpr bool monotone = true;
+        T operator()(const T& a, const T& b) const { return a + b; }
+        T identity() const { return T(0); }
+        T inverse(const T& a) const { return -a; }
+    };
+
+    template <typename T>
+    struct xorOp {
+        T operator()(const T& a, const T& b) const { return a ^ b; }
+        T identity() const { return T(0); }
+        T inverse(const T& a) const { return a; }
+    };
+
+    template <typename T, T MOD>
+    struct modPlusOp {
+        T operator()(const T& a, const T& b) const { T s = a + b; return s >= MOD ? s - MOD : s; }
+        T identity() const { return T(0); }
+        T inverse(const T& a) const { return a == 0 ? T(0) : MOD - a; }
+    };
+
+    template <typename T>
+    struct maxOp {
+        static constexpr bool monotone = true;
+        T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+        T identity() const { return numeric_limits<T>::lowest(); }
+    };
+
+    template <typename T>
+    struct minOp {
+        T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+        T identity() const { return numeric_limits<T>::max(); }
+    };
+
+    // Compile-time traits over an Op: inverse() present? monotone flag set?
+    template <typename Op, typename T, typename = void>
+    struct bitHasInverse : false_type {};
+    template <typename Op, typename T>
+    struct bitHasInverse<Op, T, void_t<decltype(declval<const Op&>().inverse(declval<const T&>()))>> : true_type {};
+
+    template <typename Op, typename = void>
+    struct bitIsMonotone : false_type {};
+    template <typename Op>
+    struct bitIsMonotone<Op, void_t<decltype(Op::monotone)>> : integral_constant<bool, Op::monotone> {};
+#endif
 
     template <typename T, typename Op>
     class BIT_1D_RU {
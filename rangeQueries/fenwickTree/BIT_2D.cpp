@@ -14,7 +14,7 @@ inline namespace MY{
         ========================================
 
         1. BIT_2D(n, m)                      → Constructor (empty)          | Time: O(n·m)        | Space: O(n·m)
-        2. BIT_2D(matrix)                    → Constructor (build from matrix) | Time: O(n·m·log²n) | Space: O(n·m)
+        2. BIT_2D(matrix)                    → Constructor (build from matrix) | Time: O(n·m)        | Space: O(n·m)
         3. update(x, y, delta)               → Add delta at (x, y)          | Time: O(log n · log m) | Space: O(1)
         4. prefixSum(x, y)                   → Query prefix sum (1,1→x,y)   | Time: O(log n · log m) | Space: O(1)
         5. rangeSum(x1, y1, x2, y2)          → Query sum on submatrix       | Time: O(log n · log m) | Space: O(1)
@@ -29,6 +29,7 @@ inline namespace MY{
         - newValue     = target value to set at (x, y)
         - (x1, y1, x2, y2) define rectangle corners
         - T can be int, long long, or double
+        - For sparse points in a huge coordinate space see BIT_2D_Compressed
     */
 
 
@@ -51,12 +52,20 @@ inline namespace MY{
             m = matrix[0].size();
             bit.assign(n + 1, vector<T>(m + 1, T(0)));
 
-            // Build by inserting each value (O(n·m·log²n))
+            // Linear build (O(n·m)): push each cell into its Fenwick parent along
+            // the row, then push whole rows into their Fenwick parent row
             for (int i = 1; i <= n; i++) {
+                for (int j = 1; j <= m; j++) bit[i][j] += matrix[i - 1][j - 1];
                 for (int j = 1; j <= m; j++) {
-                    update(i, j, matrix[i - 1][j - 1]);
+                    int p = j + (j & -j);
+                    if (p <= m) bit[i][p] += bit[i][j];
                 }
             }
+            for (int i = 1; i <= n; i++) {
+                int p = i + (i & -i);
+                if (p > n) continue;
+                for (int j = 1; j <= m; j++) bit[p][j] += bit[i][j];
+            }
         }
 
         // Add delta to element (x, y)
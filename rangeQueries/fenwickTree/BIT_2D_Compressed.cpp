@@ -0,0 +1,160 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===================================================
+        BIT_2D_Compressed Class — Function Complexities
+        ===================================================
+
+        Offline-compressed 2D Fenwick tree for sparse points in a huge coordinate space
+        (e.g. 10^6 points in [-10^18, 10^18]²). All update points must be known up front.
+        x is compressed globally; Fenwick row i keeps only the sorted, distinct y values of
+        the points it covers, and all rows live back to back in one flat array (CSR style:
+        row i owns ys[start[i] .. start[i+1]) and the matching slice of tree).
+
+        1. BIT_2D_Compressed(points)          → Constructor (register update points) | Time: O(N log N) | Space: O(N log N)
+        2. update(x, y, delta)                → Add delta at registered point (x, y) | Time: O(log² N)  | Space: O(1)
+        3. prefixSum(x, y)                    → Sum over points with px <= x, py <= y | Time: O(log² N)  | Space: O(1)
+        4. rangeSum(x1, y1, x2, y2)           → Sum on rectangle [x1, x2] × [y1, y2]   | Time: O(log² N)  | Space: O(1)
+        5. pointQuery(x, y)                   → Current value at (x, y)               | Time: O(log² N)  | Space: O(1)
+        6. setValue(x, y, newValue)           → Set registered point to newValue      | Time: O(log² N)  | Space: O(1)
+        7. size()                             → Number of distinct registered points  | Time: O(1)
+
+        Where:
+        ---------------------------------------------------
+        - N            = number of registered points
+        - (x, y)       = raw coordinates of type C (any value, no 1-indexing)
+        - update / setValue throw out_of_range for a point not registered in the constructor;
+          queries accept arbitrary coordinates (rectangle corners need not be points)
+        - All values start at 0
+
+        Usage Example:
+            vector<pair<long long,long long>> pts = {{1e9, 5}, {-3, 1e9}, {7, 7}};
+            BIT_2D_Compressed<long long> bit(pts);
+            bit.update(1e9, 5, 10);
+            long long s = bit.rangeSum(0, 0, 1e9, 1e9);   // 10
+    */
+
+
+
+    template <typename T, typename C = long long>
+    class BIT_2D_Compressed {
+    private:
+        vector<C> xs;          // distinct x, sorted
+        vector<int> start;     // start[i] = offset of Fenwick row i (1-based rows), size |xs| + 2
+        vector<C> ys;          // per-row sorted distinct y, concatenated
+        vector<T> tree;        // per-row 1-based Fenwick over that row's ys, same layout as ys
+        int points = 0;
+
+        inline int rowLen(int i) const { return start[i + 1] - start[i]; }
+
+        // Number of xs that are <= x (inclusive) or < x
+        inline int countX(C x, bool inclusive) const {
+            return inclusive ? int(upper_bound(xs.begin(), xs.end(), x) - xs.begin())
+                             : int(lower_bound(xs.begin(), xs.end(), x) - xs.begin());
+        }
+
+        // Sum over points with x-rank <= cx and yLo <= y <= yHi; one row walk serves both
+        // y bounds, and each row's two Fenwick walks stop as soon as they meet
+        T strip(int cx, C yLo, C yHi) const {
+            T sum = T(0);
+            for (int i = cx; i > 0; i -= i & -i) {
+                const C* row = ys.data() + start[i];
+                int len = rowLen(i);
+                int hi = int(upper_bound(row, row + len, yHi) - row);
+                int lo = int(lower_bound(row, row + hi, yLo) - row);
+                const T* t = tree.data() + start[i] - 1;     // 1-based view of row i
+                while (hi > lo) { sum += t[hi]; hi -= hi & -hi; }
+                while (lo > hi) { sum -= t[lo]; lo -= lo & -lo; }
+            }
+            return sum;
+        }
+
+    public:
+        explicit BIT_2D_Compressed(vector<pair<C, C>> pts) {
+            xs.reserve(pts.size());
+            for (auto& p : pts) xs.push_back(p.first);
+            sort(xs.begin(), xs.end());
+            xs.erase(unique(xs.begin(), xs.end()), xs.end());
+            int n = xs.size();
+
+            // visiting points in (y, x) order makes every row's y list come out sorted,
+            // duplicates are adjacent and dropped via the last y written to that row
+            sort(pts.begin(), pts.end(), [](const pair<C, C>& a, const pair<C, C>& b) {
+                return a.second != b.second ? a.second < b.second : a.first < b.first;
+            });
+            pts.erase(unique(pts.begin(), pts.end()), pts.end());
+            points = pts.size();
+
+            vector<int> xr(pts.size());
+            for (size_t k = 0; k < pts.size(); k++) xr[k] = countX(pts[k].first, false) + 1;
+
+            vector<int> cnt(n + 2, 0);
+            vector<char> seen(n + 2, 0);
+            vector<C> last(n + 2);
+            auto walk = [&](auto&& emit) {
+                fill(seen.begin(), seen.end(), 0);
+                for (size_t k = 0; k < pts.size(); k++) {
+                    C y = pts[k].second;
+                    for (int i = xr[k]; i <= n; i += i & -i) {
+                        if (seen[i] && last[i] == y) continue;
+                        seen[i] = 1;
+                        last[i] = y;
+                        emit(i, y);
+                    }
+                }
+            };
+
+            walk([&](int i, C) { cnt[i]++; });
+            start.assign(n + 2, 0);
+            for (int i = 1; i <= n; i++) start[i + 1] = start[i] + cnt[i];
+            ys.resize(start[n + 1]);
+            tree.assign(start[n + 1], T(0));
+
+            vector<int> pos(start.begin(), start.end());
+            walk([&](int i, C y) { ys[pos[i]++] = y; });
+        }
+
+        // Add delta at registered point (x, y)
+        void update(C x, C y, T delta) {
+            int cx = countX(x, false);
+            if (cx == (int)xs.size() || xs[cx] != x) throw out_of_range("BIT_2D_Compressed::update - point not registered");
+            for (int i = cx + 1; i < (int)start.size() - 1; i += i & -i) {
+                const C* row = ys.data() + start[i];
+                int len = rowLen(i);
+                int j = int(lower_bound(row, row + len, y) - row);
+                if (j == len || row[j] != y) throw out_of_range("BIT_2D_Compressed::update - point not registered");
+                T* t = tree.data() + start[i] - 1;
+                for (++j; j <= len; j += j & -j) t[j] += delta;
+            }
+        }
+
+        // Sum over points with px <= x and py <= y
+        T prefixSum(C x, C y) const {
+            return strip(countX(x, true), numeric_limits<C>::lowest(), y);
+        }
+
+        // Sum over rectangle [x1, x2] × [y1, y2] (inclusive, raw coordinates)
+        T rangeSum(C x1, C y1, C x2, C y2) const {
+            if (x1 > x2 || y1 > y2) return T(0);
+            int hi = countX(x2, true), lo = countX(x1, false);
+            return strip(hi, y1, y2) - strip(lo, y1, y2);
+        }
+
+        T pointQuery(C x, C y) const { return rangeSum(x, y, x, y); }
+
+        // Set registered point (x, y) to a new value
+        void setValue(C x, C y, T newValue) {
+            update(x, y, newValue - pointQuery(x, y));
+        }
+
+        int size() const { return points; }
+    };
+}
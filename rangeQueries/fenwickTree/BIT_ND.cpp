@@ -0,0 +1,171 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ========================================
+        BIT_ND<T, D> Class — Function Complexities
+        ========================================
+
+        D-dimensional range-add / range-sum Fenwick tree (D fixed at compile time),
+        generalizing the two-tree trick of BIT_1D_RU. A range add becomes 2^D corner
+        updates of the difference array d, and
+
+            prefix(x) = Σ_{p <= x} d[p] · Π_k ((x_k + 1) - p_k)
+                      = Σ_{S ⊆ dims} Π_{k ∉ S} (x_k + 1) · Σ_{p <= x} d[p] · Π_{k ∈ S} (-p_k)
+
+        so one Fenwick tree per subset S (2^D coefficient trees) is enough. All trees share
+        one contiguous buffer, interleaved per cell (cell-major, then subset), so a cell
+        visited by an update or query touches 2^D adjacent values.
+
+        1. BIT_ND(dims)                      → Constructor, all zeros        | Time: O(2^D · Π n_k) | Space: O(2^D · Π n_k)
+        2. rangeAdd(lo, hi, val)             → Add val on box [lo, hi]       | Time: O(4^D · Π log n_k) | Space: O(1)
+        3. rangeSum(lo, hi)                  → Sum over box [lo, hi]         | Time: O(4^D · Π log n_k) | Space: O(1)
+        4. prefixSum(x)                      → Sum over box [1, min(x, n)]   | Time: O(2^D · Π log n_k) | Space: O(1)
+        5. pointAdd(p, val)                  → Add val at p                  | Time: O(4^D · Π log n_k) | Space: O(1)
+        6. pointQuery(p)                     → Value at p                    | Time: O(4^D · Π log n_k) | Space: O(1)
+        7. dims()                            → Size per dimension            | Time: O(1)
+
+        Where:
+        ----------------------------------------
+        - D            = number of dimensions (template parameter, D >= 1)
+        - dims, lo, hi = array<int, D>; coordinates are 1-indexed like BIT_2D,
+                         boxes are inclusive, invalid boxes throw out_of_range
+        - T must hold Σ val · Π n_k (use long long / __int128 for large grids)
+
+        Usage Example:
+            BIT_ND<long long, 3> heat({100, 100, 100});
+            heat.rangeAdd({1, 1, 1}, {50, 60, 70}, 5);
+            long long s = heat.rangeSum({10, 10, 10}, {80, 80, 80});
+    */
+
+
+
+    template <typename T, int D>
+    class BIT_ND {
+    private:
+        static_assert(D >= 1, "BIT_ND: D must be at least 1");
+        static constexpr int M = 1 << D;       // number of coefficient trees
+
+        using Point = array<int, D>;
+        using Coef = array<T, M>;
+
+        Point n;
+        array<size_t, D> stride;                // stride[k] in cells, last dimension fastest
+        vector<T> buf;                          // buf[cell * M + subset]
+
+        template <int k>
+        void addRec(size_t off, const Point& p, const Coef& c) {
+            for (int i = p[k]; i <= n[k]; i += i & -i) {
+                size_t o = off + (size_t)i * stride[k];
+                if constexpr (k + 1 == D) {
+                    T* cell = buf.data() + o * M;
+                    for (int s = 0; s < M; s++) cell[s] += c[s];
+                } else {
+                    addRec<k + 1>(o, p, c);
+                }
+            }
+        }
+
+        template <int k>
+        void sumRec(size_t off, const Point& x, Coef& acc) const {
+            for (int i = x[k]; i > 0; i -= i & -i) {
+                size_t o = off + (size_t)i * stride[k];
+                if constexpr (k + 1 == D) {
+                    const T* cell = buf.data() + o * M;
+                    for (int s = 0; s < M; s++) acc[s] += cell[s];
+                } else {
+                    sumRec<k + 1>(o, x, acc);
+                }
+            }
+        }
+
+        // d[p] += val on the difference array: tree S gets val · Π_{k ∈ S} (-p_k)
+        void cornerAdd(const Point& p, T val) {
+            Coef c;
+            for (int s = 0; s < M; s++) {
+                T v = val;
+                for (int k = 0; k < D; k++) if (s >> k & 1) v *= -T(p[k]);
+                c[s] = v;
+            }
+            addRec<0>(0, p, c);
+        }
+
+        void checkBox(const Point& lo, const Point& hi) const {
+            for (int k = 0; k < D; k++)
+                if (lo[k] < 1 || hi[k] > n[k] || lo[k] > hi[k])
+                    throw out_of_range("BIT_ND: invalid box");
+        }
+
+    public:
+        explicit BIT_ND(const Point& dims) : n(dims) {
+            size_t cells = 1;
+            for (int k = D - 1; k >= 0; k--) {
+                if (n[k] < 1) throw invalid_argument("BIT_ND: every dimension must be positive");
+                stride[k] = cells;
+                cells *= (size_t)n[k] + 1;
+            }
+            buf.assign(cells * M, T(0));
+        }
+
+        // Sum over box [1, x] (any x_k <= 0 gives 0, x_k > n_k is clamped to n_k)
+        T prefixSum(Point x) const {
+            for (int k = 0; k < D; k++) {
+                if (x[k] <= 0) return T(0);
+                x[k] = min(x[k], n[k]);
+            }
+            Coef acc{};
+            sumRec<0>(0, x, acc);
+            T res = T(0);
+            for (int s = 0; s < M; s++) {
+                T v = acc[s];
+                for (int k = 0; k < D; k++) if (!(s >> k & 1)) v *= T(x[k] + 1);
+                res += v;
+            }
+            return res;
+        }
+
+        // Add val to every cell of box [lo, hi]
+        void rangeAdd(const Point& lo, const Point& hi, T val) {
+            checkBox(lo, hi);
+            for (int c = 0; c < M; c++) {
+                Point p;
+                bool inside = true, neg = false;
+                for (int k = 0; k < D; k++) {
+                    if (c >> k & 1) { p[k] = hi[k] + 1; neg = !neg; }
+                    else p[k] = lo[k];
+                    if (p[k] > n[k]) inside = false;
+                }
+                if (inside) cornerAdd(p, neg ? -val : val);
+            }
+        }
+
+        // Sum over box [lo, hi]
+        T rangeSum(const Point& lo, const Point& hi) const {
+            checkBox(lo, hi);
+            T res = T(0);
+            for (int c = 0; c < M; c++) {
+                Point x;
+                bool neg = false;
+                for (int k = 0; k < D; k++) {
+                    if (c >> k & 1) { x[k] = lo[k] - 1; neg = !neg; }
+                    else x[k] = hi[k];
+                }
+                T v = prefixSum(x);
+                res += neg ? -v : v;
+            }
+            return res;
+        }
+
+        void pointAdd(const Point& p, T val) { rangeAdd(p, p, val); }
+        T pointQuery(const Point& p) const { return rangeSum(p, p); }
+
+        const Point& dims() const { return n; }
+    };
+}
@@ -11,7 +11,7 @@ inline namespace MY{
     
     /*
         ========================================
-        BIT_prodMod<T> Class — Function Complexities
+        BIT_prodMod<T, R> Class — Function Complexities
         ========================================
 
         1. BIT_prodMod(n, mod, oneIndexed)         → Constructor (empty)                 | Time: O(n)          | Space: O(n)
@@ -37,12 +37,110 @@ inline namespace MY{
         - bit            = internal multiplicative BIT
         - bitZ           = BIT tracking zero counts (for zero-handling logic)
         - all operations are modulo `mod`
-
+        - R              = modular-multiplication backend (Int128Reducer, BarrettReducer,
+                           MontgomeryReducer, StaticMontgomery<MOD>; see maths/modint.cpp);
+                           the tree is kept in R's internal form, construction throws
+                           invalid_argument if R cannot handle `mod`
+
+        Usage Example:
+            BIT_prodMod<long long> a(vals);                              // __int128 % mod
+            BIT_prodMod<long long, StaticMontgomery<1000000007>> b(vals); // no 128-bit division
     */
 
 
+#ifndef MOD_REDUCERS_DEFINED
+#define MOD_REDUCERS_DEFINED
+    struct Int128Reducer {
+        uint64_t m;
+        explicit Int128Reducer(uint64_t mod = 1000000007ULL) : m(mod) {}
+        static bool supports(uint64_t mod) { return mod >= 1; }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const { return (uint64_t)((unsigned __int128)a * b % m); }
+    };
+
+    // q = floor(z / m) up to one, from the high half of z · ceil(2^64 / m)
+    struct BarrettReducer {
+        uint64_t m, im;
+        explicit BarrettReducer(uint64_t mod = 998244353ULL) : m(mod), im(~0ULL / mod + 1) {}
+        static bool supports(uint64_t mod) { return mod >= 1 && mod < (1ULL << 32); }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const {
+            uint64_t z = a * b;
+            uint64_t x = (uint64_t)(((unsigned __int128)z * im) >> 64);
+            uint64_t y = x * m;
+            return z - y + (z < y ? m : 0);
+        }
+    };
+
+    // Internal form a · 2^64 mod m; reduce(t) = t · 2^-64 mod m
+    struct MontgomeryReducer {
+        uint64_t m, inv, r2;
+        explicit MontgomeryReducer(uint64_t mod = 1000000007ULL) : m(mod), inv(1) {
+            for (int i = 0; i < 6; ++i) inv *= 2 - mod * inv;          // m^-1 mod 2^64 (Newton)
+            r2 = (uint64_t)(-(unsigned __int128)mod % mod);            // 2^128 mod m
+        }
+        static bool supports(uint64_t mod) { return (mod & 1) && mod < (1ULL << 63); }
+        uint64_t reduce(unsigned __int128 t) const {
+            uint64_t q = (uint64_t)t * inv;
+            uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * m) >> 64);
+            return a >= b ? a - b : a - b + m;
+        }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return to(1); }
+        uint64_t to(uint64_t x) const { return reduce((unsigned __int128)(x % m) * r2); }
+        uint64_t from(uint64_t a) const { return reduce(a); }
+        uint64_t mul(uint64_t a, uint64_t b) const { return reduce((unsigned __int128)a * b); }
+    };
+
+    // Montgomery with MOD known at compile time; MOD < 2^31 runs entirely in 64-bit registers
+    template <uint64_t MOD>
+    struct StaticMontgomery {
+        static_assert((MOD & 1) && MOD < (1ULL << 63), "StaticMontgomery: MOD must be odd and < 2^63");
+        static constexpr bool SMALL = MOD < (1ULL << 31);
+
+        static constexpr uint64_t inv64() { uint64_t x = 1; for (int i = 0; i < 6; ++i) x *= 2 - MOD * x; return x; }
+        static constexpr uint64_t INV = inv64();
+        // SMALL uses radix 2^32 (R2 = 2^64 mod MOD), otherwise radix 2^64 (R2 = 2^128 mod MOD)
+        static constexpr uint64_t R2 = SMALL ? (uint64_t)((((unsigned __int128)1) << 64) % MOD)
+                                             : (uint64_t)((-(unsigned __int128)MOD) % MOD);
 
-    template<typename T>
+        explicit StaticMontgomery(uint64_t mod = MOD) {
+            if (mod != MOD) throw invalid_argument("StaticMontgomery: modulus differs from MOD");
+        }
+        static bool supports(uint64_t mod) { return mod == MOD; }
+
+        static uint64_t reduce(unsigned __int128 t) {
+            if constexpr (SMALL) {
+                uint64_t x = (uint64_t)t;
+                uint32_t q = (uint32_t)x * (uint32_t)(0 - INV);         // -MOD^-1 mod 2^32
+                uint64_t r = (x + (uint64_t)q * MOD) >> 32;
+                return r >= MOD ? r - MOD : r;
+            } else {
+                uint64_t q = (uint64_t)t * INV;
+                uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * MOD) >> 64);
+                return a >= b ? a - b : a - b + MOD;
+            }
+        }
+        static constexpr uint64_t mod() { return MOD; }
+        static uint64_t one() { return to(1); }
+        static uint64_t to(uint64_t x) { return reduce((unsigned __int128)(x % MOD) * R2); }
+        static uint64_t from(uint64_t a) { return reduce(a); }
+        static uint64_t mul(uint64_t a, uint64_t b) {
+            if constexpr (SMALL) return reduce(a * b);
+            else return reduce((unsigned __int128)a * b);
+        }
+    };
+#endif
+
+
+
+    template<typename T, typename R = Int128Reducer>
     class BIT_prodMod {
     public:
         static constexpr long long DEFAULT_MOD = 1000000007LL;
@@ -50,7 +148,8 @@ inline namespace MY{
     private:
         int n;                          // number of elements
         T mod;                          // modulus (must be prime!)
-        vector<T> bit;                  // multiplicative BIT
+        R red;                          // multiplication backend for `mod`
+        vector<T> bit;                  // multiplicative BIT (R's internal form)
         vector<int> bitZ;               // zero-count BIT
         vector<T> arr;                  // stored values
         bool externalOneIndexed;        // true if external indices are 1-based
@@ -61,17 +160,23 @@ inline namespace MY{
             return idx;
         }
 
-        // Modular multiplication using __int128_t to avoid overflow
+        static R makeReducer(T mod_) {
+            if (mod_ < 1 || !R::supports((uint64_t)mod_)) throw invalid_argument("BIT_prodMod: modulus not supported by reducer");
+            return R((uint64_t)mod_);
+        }
+
+        // Modular multiplication of two internal-form values
         inline T mulMod(T a, T b) const {
-            __int128_t x = (__int128_t)a * b;
-            return (T)(x % mod);
+            return (T)red.mul((uint64_t)a, (uint64_t)b);
         }
 
-        // Modular exponentiation
+        // Normal value in [0, mod) → internal form
+        inline T toRed(T v) const { return (T)red.to((uint64_t)v); }
+        inline T fromRed(T a) const { return (T)red.from((uint64_t)a); }
+
+        // Modular exponentiation of an internal-form base
         T modPow(T a, long long e) const {
-            a %= mod;
-            if (a < 0) a += mod;
-            T res = 1;
+            T res = (T)red.one();
             while (e > 0) {
                 if (e & 1) res = mulMod(res, a);
                 a = mulMod(a, a);
@@ -87,7 +192,7 @@ inline namespace MY{
         }
 
         T mulQueryInternal(int idx) const {
-            T res = 1;
+            T res = (T)red.one();
             for (; idx > 0; idx -= idx & -idx)
                 res = mulMod(res, bit[idx]);
             return res;
@@ -109,7 +214,7 @@ inline namespace MY{
         // Build tree from input vector
         void buildFromVector(const vector<T>& input) {
             n = (int)input.size();
-            bit.assign(n + 1, 1);
+            bit.assign(n + 1, (T)red.one());
             bitZ.assign(n + 1, 0);
             arr.assign(n + 1, 1);
 
@@ -119,9 +224,9 @@ inline namespace MY{
                 arr[i] = v;
                 if (v == 0) {
                     addCountInternal(i, 1);
-                    bit[i] = 1; // neutral element
+                    bit[i] = (T)red.one(); // neutral element
                 } else {
-                    bit[i] = v;
+                    bit[i] = toRed(v);
                 }
             }
 
@@ -134,13 +239,13 @@ inline namespace MY{
     public:
         // Constructor with size (default initialize to 1s)
         BIT_prodMod(int n_ = 0, T mod_ = (T)DEFAULT_MOD, bool oneIndexed = true)
-            : n(n_), mod(mod_), bit(n_ + 1, 1), bitZ(n_ + 1, 0),
+            : n(n_), mod(mod_), red(makeReducer(mod_)), bit(n_ + 1, (T)red.one()), bitZ(n_ + 1, 0),
             arr(n_ + 1, 1), externalOneIndexed(oneIndexed)
         { }
 
         // Constructor from vector
         BIT_prodMod(const vector<T>& input, T mod_ = (T)DEFAULT_MOD, bool oneIndexed = true)
-            : n(0), mod(mod_), bit(), bitZ(), arr(), externalOneIndexed(oneIndexed)
+            : n(0), mod(mod_), red(makeReducer(mod_)), bit(), bitZ(), arr(), externalOneIndexed(oneIndexed)
         {
             buildFromVector(input);
         }
@@ -160,14 +265,14 @@ inline namespace MY{
             }
             if (old == 0 && newVal != 0) {
                 addCountInternal(i, -1);
-                mulUpdateInternal(i, newVal);
+                mulUpdateInternal(i, toRed(newVal));
             } else if (old != 0 && newVal == 0) {
-                T invOld = modPow(old, (long long)mod - 2);
+                T invOld = modPow(toRed(old), (long long)mod - 2);
                 addCountInternal(i, 1);
                 mulUpdateInternal(i, invOld);
             } else {
-                T invOld = modPow(old, (long long)mod - 2);
-                T factor = mulMod(newVal, invOld);
+                T invOld = modPow(toRed(old), (long long)mod - 2);
+                T factor = mulMod(toRed(newVal), invOld);
                 mulUpdateInternal(i, factor);
             }
             arr[i] = newVal;
@@ -182,7 +287,7 @@ inline namespace MY{
         // Query product of prefix [0..r]
         T prefixProduct(int r) const {
             int ri = toInternal(r);
-            return mulQueryInternal(ri);
+            return fromRed(mulQueryInternal(ri));
         }
 
         // Query product in range [l..r]
@@ -196,7 +301,7 @@ inline namespace MY{
             T prefR = mulQueryInternal(ri);
             T prefLm1 = mulQueryInternal(li - 1);
             T invPrefLm1 = modPow(prefLm1, (long long)mod - 2);
-            return mulMod(prefR, invPrefLm1);
+            return fromRed(mulMod(prefR, invPrefLm1));
         }
 
         // Size accessor
@@ -212,7 +317,7 @@ inline namespace MY{
         }
 
         void printBIT() const {
-            for (int i = 1; i <= n; i++) cout << bit[i] << " ";
+            for (int i = 1; i <= n; i++) cout << fromRed(bit[i]) << " ";
             cout << "\n";
         }
 
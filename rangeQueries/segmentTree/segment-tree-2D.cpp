@@ -46,6 +46,9 @@ inline namespace MY{
             x1,y1,x2,y2= 1-based rectangle corners
             x,y         = single cell coordinates (1-based)
             val         = assigned or added value
+
+        Note: this is a quadtree, so a thin-strip query (one row or column band) visits O(n)
+        nodes. Use SegTree2DFlat below when band queries dominate.
     */
 
 
@@ -303,4 +306,272 @@ inline namespace MY{
 
         T query_point(int x,int y) { return query_sum(x,y,x,y); }
     };
+
+
+
+    /*
+        ===============================
+        SegTree2DFlat Class — Function Complexities
+        ===============================
+
+        Segment tree of segment trees over one preallocated flat buffer, with the public API
+        of SegTree2D, so callers can switch by changing the type. Update costs differ from
+        SegTree2D, though: update_add is O(log n · log m) only while just sums are read, and
+        update_set, or a min/max read after adds, pays for the touched cells (see below).
+        The outer tree runs over rows and the inner trees over columns. Both are bottom-up,
+        non-power-of-two trees: outer node ox owns inner node iy at index ox · 2m + iy.
+        sum / min / max are stored as three separate arrays, so each query touches one of
+        them. Inner leaves of outer leaves are the cells themselves.
+
+        Queries have a worst case of O(log n · log m) for every rectangle shape, including
+        thin strips. update_add does not touch the cells: it records the rectangle in a 2D
+        range-add / range-sum Fenwick layer (the four coefficient trees of BIT_ND<T, 2>),
+        which query_sum and query_point add on top of the stored sums. The first query_min,
+        query_max or update_set after some adds flushes them into the cells. Each pending
+        rectangle is written cell by cell, or everything is rebuilt at once if that is
+        cheaper, so the flush costs O(min(Σ (h + log n)(w + log m), n · m)).
+        update_set writes the h × w cells, then recomputes only the affected outer nodes
+        (about 2h + log n of them), and within each of those only the columns y1..y2 and
+        their inner ancestors.
+        No polylog lazy scheme is known for 2D min/max under range add/assign: a node that
+        only partly overlaps in x cannot update its min from a tag. So those paths are
+        bounded by the rectangle instead.
+
+        1. SegTree2DFlat(mat) / build(mat)        → Build from matrix                | Time: O(n * m) | Space: O(4 * n * m) per aggregate
+        2. update_add(x1, y1, x2, y2, val)        → Add val to submatrix             | Time: O(log n * log m) (+ flush, see above)
+        3. update_set(x1, y1, x2, y2, val)        → Assign val to submatrix          | Time: O((h + log n) * (w + log m)) + flush
+        4. query_sum(x1, y1, x2, y2)              → Sum of submatrix                 | Time: O(log n * log m)
+        5. query_min(x1, y1, x2, y2)              → Minimum in submatrix             | Time: O(log n * log m) + flush
+        6. query_max(x1, y1, x2, y2)              → Maximum in submatrix             | Time: O(log n * log m) + flush
+        7. query_point(x, y)                      → Cell value                       | Time: O(1) without pending adds, else O(log n * log m)
+
+        Where:
+            n, m        = matrix dimensions (rows, columns)
+            x1,y1,x2,y2 = 0-based rectangle corners, clamped to the grid like SegTree2D
+            h, w        = rows / columns of the updated rectangle
+            Memory      = 3 · 4nm values of T, plus 4nm more once update_add is first used
+                          (e.g. 4096 × 4096 long long ≈ 1.5 GB + 0.5 GB, int ≈ 0.8 GB + 0.27 GB),
+                          and one small record per update_add since the last flush
+
+        Usage Example:
+            SegTree2DFlat<long long> st(mat);
+            st.update_add(0, 10, 4095, 10, 5);          // one column band
+            long long s = st.query_sum(0, 0, 4095, 20); // O(log n · log m) regardless of shape
+    */
+
+
+
+    template<typename T>
+    class SegTree2DFlat {
+        int n = 0, m = 0;
+        size_t stride = 0;                  // 2m, inner tree size
+        vector<T> sum, mn, mx;              // index ox * stride + iy
+
+        // Pending range adds: 2D Fenwick over the difference array, four coefficients per
+        // cell interleaved (Σd, Σd·x, Σd·y, Σd·x·y), 1-based, index ((x·(m+1) + y) · 4)
+        vector<T> addTree;
+        struct PendingAdd { int x1, y1, x2, y2; T val; };
+        vector<PendingAdd> pending;
+
+        inline void pull(size_t a, size_t b, size_t c) {     // node a = combine(b, c)
+            sum[a] = sum[b] + sum[c];
+            mn[a] = min(mn[b], mn[c]);
+            mx[a] = max(mx[b], mx[c]);
+        }
+
+        // Inner ancestors of columns [y1, y2] in outer node ox
+        void pullInner(int ox, int y1, int y2) {
+            size_t base = (size_t)ox * stride;
+            for (int l = (y1 + m) >> 1, r = (y2 + m) >> 1; l >= 1; l >>= 1, r >>= 1)
+                for (int iy = l; iy <= r; iy++) pull(base + iy, base + 2 * iy, base + 2 * iy + 1);
+        }
+
+        // Recompute every outer ancestor of rows [x1, x2] on columns [y1, y2]
+        void pullOuter(int x1, int x2, int y1, int y2) {
+            for (int l = (x1 + n) >> 1, r = (x2 + n) >> 1; l >= 1; l >>= 1, r >>= 1) {
+                for (int ox = l; ox <= r; ox++) {
+                    size_t a = (size_t)ox * stride, b = a * 2, c = b + stride;
+                    for (int iy = y1 + m; iy <= y2 + m; iy++) pull(a + iy, b + iy, c + iy);
+                    pullInner(ox, y1, y2);
+                }
+            }
+        }
+
+        void addCorner(int x, int y, T d) {
+            if (x > n || y > m) return;
+            T dx = d * T(x), dy = d * T(y), dxy = dx * T(y);
+            for (int i = x; i <= n; i += i & -i) {
+                T* row = addTree.data() + (size_t)i * (m + 1) * 4;
+                for (int j = y; j <= m; j += j & -j) {
+                    T* c = row + (size_t)j * 4;
+                    c[0] += d; c[1] += dx; c[2] += dy; c[3] += dxy;
+                }
+            }
+        }
+
+        // Pending-add sum over cells [1, X] × [1, Y] (1-based)
+        T addPrefix(int X, int Y) const {
+            T a = 0, b = 0, c = 0, d = 0;
+            for (int i = X; i > 0; i -= i & -i) {
+                const T* row = addTree.data() + (size_t)i * (m + 1) * 4;
+                for (int j = Y; j > 0; j -= j & -j) {
+                    const T* p = row + (size_t)j * 4;
+                    a += p[0]; b += p[1]; c += p[2]; d += p[3];
+                }
+            }
+            return T(X + 1) * T(Y + 1) * a - T(Y + 1) * b - T(X + 1) * c + d;
+        }
+
+        // Rectangle given 0-based, inclusive
+        void addRect(int x1, int y1, int x2, int y2, T val) {
+            addCorner(x1 + 1, y1 + 1, val);
+            addCorner(x1 + 1, y2 + 2, -val);
+            addCorner(x2 + 2, y1 + 1, -val);
+            addCorner(x2 + 2, y2 + 2, val);
+        }
+
+        T addSum(int x1, int y1, int x2, int y2) const {
+            return addPrefix(x2 + 1, y2 + 1) - addPrefix(x1, y2 + 1) - addPrefix(x2 + 1, y1) + addPrefix(x1, y1);
+        }
+
+        // Moves every pending add into the cells, per rectangle or by one full rebuild
+        void flush() {
+            if (pending.empty()) return;
+            auto lg = [](int v) { return 32 - __builtin_clz((unsigned)v); };
+            double perRect = 0, full = (double)n * m;
+            for (const PendingAdd& p : pending)
+                perRect += (double)(p.x2 - p.x1 + 1 + lg(n)) * (p.y2 - p.y1 + 1 + lg(m));
+
+            if (perRect < full) {
+                for (const PendingAdd& p : pending) {
+                    addRect(p.x1, p.y1, p.x2, p.y2, -p.val);
+                    T val = p.val;
+                    updateRect(p.x1, p.y1, p.x2, p.y2, [val](T cur) { return cur + val; });
+                }
+            } else {
+                // 2D difference array of all pending rectangles, then one rebuild
+                vector<T> diff((size_t)(n + 1) * (m + 1), T(0));
+                auto at = [&](int x, int y) -> T& { return diff[(size_t)x * (m + 1) + y]; };
+                for (const PendingAdd& p : pending) {
+                    at(p.x1, p.y1) += p.val; at(p.x1, p.y2 + 1) -= p.val;
+                    at(p.x2 + 1, p.y1) -= p.val; at(p.x2 + 1, p.y2 + 1) += p.val;
+                }
+                for (int x = 0; x < n; x++) {
+                    size_t base = (size_t)(x + n) * stride + m;
+                    for (int y = 0; y < m; y++) {
+                        if (x) at(x, y) += at(x - 1, y);
+                        if (y) at(x, y) += at(x, y - 1);
+                        if (x && y) at(x, y) -= at(x - 1, y - 1);
+                        T v = sum[base + y] + at(x, y);
+                        sum[base + y] = mn[base + y] = mx[base + y] = v;
+                    }
+                    pullInner(x + n, 0, m - 1);
+                }
+                pullOuter(0, n - 1, 0, m - 1);
+                fill(addTree.begin(), addTree.end(), T(0));
+            }
+            pending.clear();
+        }
+
+        bool clamp(int& x1, int& y1, int& x2, int& y2) const {
+            if (!n || !m) return false;
+            x1 = max(0, x1); y1 = max(0, y1);
+            x2 = min(n-1, x2); y2 = min(m-1, y2);
+            return x1 <= x2 && y1 <= y2;
+        }
+
+        template <typename Apply>
+        void updateRect(int x1, int y1, int x2, int y2, Apply apply) {
+            if (!clamp(x1, y1, x2, y2)) return;
+            for (int x = x1; x <= x2; x++) {
+                size_t base = (size_t)(x + n) * stride + m;
+                for (int y = y1; y <= y2; y++) {
+                    T v = apply(sum[base + y]);
+                    sum[base + y] = mn[base + y] = mx[base + y] = v;
+                }
+                pullInner(x + n, y1, y2);
+            }
+            pullOuter(x1, x2, y1, y2);
+        }
+
+        // Combines inner nodes of [y1, y2] over the outer nodes covering [x1, x2]
+        template <typename Get, typename Comb>
+        T queryRect(int x1, int y1, int x2, int y2, T init, Get get, Comb comb) const {
+            T res = init;
+            auto inner = [&](int ox) {
+                size_t base = (size_t)ox * stride;
+                for (int l = y1 + m, r = y2 + m + 1; l < r; l >>= 1, r >>= 1) {
+                    if (l & 1) res = comb(res, get(base + l++));
+                    if (r & 1) res = comb(res, get(base + --r));
+                }
+            };
+            for (int l = x1 + n, r = x2 + n + 1; l < r; l >>= 1, r >>= 1) {
+                if (l & 1) inner(l++);
+                if (r & 1) inner(--r);
+            }
+            return res;
+        }
+
+    public:
+        SegTree2DFlat() = default;
+        SegTree2DFlat(const vector<vector<T>>& mat) { build(mat); }
+
+        void build(const vector<vector<T>>& mat) {
+            n = (int)mat.size();
+            m = n ? (int)mat[0].size() : 0;
+            stride = 2 * (size_t)m;
+            size_t total = 2 * (size_t)n * stride;
+            sum.assign(total, T(0));
+            mn.assign(total, numeric_limits<T>::max());
+            mx.assign(total, numeric_limits<T>::lowest());
+            addTree.clear();
+            pending.clear();
+            if (!n || !m) return;
+            for (int x = 0; x < n; x++) {
+                size_t base = (size_t)(x + n) * stride + m;
+                for (int y = 0; y < m; y++) sum[base + y] = mn[base + y] = mx[base + y] = mat[x][y];
+                pullInner(x + n, 0, m - 1);
+            }
+            pullOuter(0, n - 1, 0, m - 1);
+        }
+
+        void update_add(int x1,int y1,int x2,int y2,T val) {
+            if (!clamp(x1, y1, x2, y2)) return;
+            if (addTree.empty()) addTree.assign((size_t)(n + 1) * (m + 1) * 4, T(0));
+            addRect(x1, y1, x2, y2, val);
+            pending.push_back({x1, y1, x2, y2, val});
+        }
+
+        void update_set(int x1,int y1,int x2,int y2,T val) {
+            flush();
+            updateRect(x1, y1, x2, y2, [val](T) { return val; });
+        }
+
+        T query_sum(int x1,int y1,int x2,int y2) const {
+            if (!clamp(x1, y1, x2, y2)) return 0;
+            T res = queryRect(x1, y1, x2, y2, T(0),
+                [&](size_t i) { return sum[i]; }, [](T a, T b) { return a + b; });
+            return pending.empty() ? res : res + addSum(x1, y1, x2, y2);
+        }
+
+        T query_min(int x1,int y1,int x2,int y2) {
+            flush();
+            if (!clamp(x1, y1, x2, y2)) return numeric_limits<T>::max();
+            return queryRect(x1, y1, x2, y2, numeric_limits<T>::max(),
+                [&](size_t i) { return mn[i]; }, [](T a, T b) { return min(a, b); });
+        }
+
+        T query_max(int x1,int y1,int x2,int y2) {
+            flush();
+            if (!clamp(x1, y1, x2, y2)) return numeric_limits<T>::lowest();
+            return queryRect(x1, y1, x2, y2, numeric_limits<T>::lowest(),
+                [&](size_t i) { return mx[i]; }, [](T a, T b) { return max(a, b); });
+        }
+
+        T query_point(int x,int y) const {
+            if (x < 0 || x >= n || y < 0 || y >= m) return 0;
+            T v = sum[(size_t)(x + n) * stride + m + y];
+            return pending.empty() ? v : v + addSum(x, y, x, y);
+        }
+    };
 }
@@ -11,7 +11,7 @@ inline namespace MY{
 
     /*
         ===============================
-        SegTreeAdv2D Class — Function Complexities (1 line each)
+        SegTreeAdv2D<T, Reducer> Class — Function Complexities (1 line each)
         ===============================
 
         SegTreeAdv2D()                               → Default constructor | Time: O(1) | Space: O(1)
@@ -35,11 +35,106 @@ inline namespace MY{
         queryGCD_rec(...)                             → Recursive GCD query | Time: O(log n * log m) | Space: O(log n * log m)
         queryLCM_rec(...)                             → Recursive LCM query | Time: O(log n * log m) | Space: O(log n * log m)
         queryProdMod_rec(...)                         → Recursive product modulo query | Time: O(log n * log m) | Space: O(log n * log m)
+
+        Reducer = backend for the MOD products (Int128Reducer default, BarrettReducer, MontgomeryReducer,
+                  StaticMontgomery<MOD>; see maths/modint.cpp). prodMod is kept in its internal form;
+                  a MOD it cannot handle throws invalid_argument.
     */
 
 
+#ifndef MOD_REDUCERS_DEFINED
+#define MOD_REDUCERS_DEFINED
+    struct Int128Reducer {
+        uint64_t m;
+        explicit Int128Reducer(uint64_t mod = 1000000007ULL) : m(mod) {}
+        static bool supports(uint64_t mod) { return mod >= 1; }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const { return (uint64_t)((unsigned __int128)a * b % m); }
+    };
+
+    // q = floor(z / m) up to one, from the high half of z · ceil(2^64 / m)
+    struct BarrettReducer {
+        uint64_t m, im;
+        explicit BarrettReducer(uint64_t mod = 998244353ULL) : m(mod), im(~0ULL / mod + 1) {}
+        static bool supports(uint64_t mod) { return mod >= 1 && mod < (1ULL << 32); }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const {
+            uint64_t z = a * b;
+            uint64_t x = (uint64_t)(((unsigned __int128)z * im) >> 64);
+            uint64_t y = x * m;
+            return z - y + (z < y ? m : 0);
+        }
+    };
+
+    // Internal form a · 2^64 mod m; reduce(t) = t · 2^-64 mod m
+    struct MontgomeryReducer {
+        uint64_t m, inv, r2;
+        explicit MontgomeryReducer(uint64_t mod = 1000000007ULL) : m(mod), inv(1) {
+            for (int i = 0; i < 6; ++i) inv *= 2 - mod * inv;          // m^-1 mod 2^64 (Newton)
+            r2 = (uint64_t)(-(unsigned __int128)mod % mod);            // 2^128 mod m
+        }
+        static bool supports(uint64_t mod) { return (mod & 1) && mod < (1ULL << 63); }
+        uint64_t reduce(unsigned __int128 t) const {
+            uint64_t q = (uint64_t)t * inv;
+            uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * m) >> 64);
+            return a >= b ? a - b : a - b + m;
+        }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return to(1); }
+        uint64_t to(uint64_t x) const { return reduce((unsigned __int128)(x % m) * r2); }
+        uint64_t from(uint64_t a) const { return reduce(a); }
+        uint64_t mul(uint64_t a, uint64_t b) const { return reduce((unsigned __int128)a * b); }
+    };
+
+    // Montgomery with MOD known at compile time; MOD < 2^31 runs entirely in 64-bit registers
+    template <uint64_t MOD>
+    struct StaticMontgomery {
+        static_assert((MOD & 1) && MOD < (1ULL << 63), "StaticMontgomery: MOD must be odd and < 2^63");
+        static constexpr bool SMALL = MOD < (1ULL << 31);
+
+        static constexpr uint64_t inv64() { uint64_t x = 1; for (int i = 0; i < 6; ++i) x *= 2 - MOD * x; return x; }
+        static constexpr uint64_t INV = inv64();
+        // SMALL uses radix 2^32 (R2 = 2^64 mod MOD), otherwise radix 2^64 (R2 = 2^128 mod MOD)
+        static constexpr uint64_t R2 = SMALL ? (uint64_t)((((unsigned __int128)1) << 64) % MOD)
+                                             : (uint64_t)((-(unsigned __int128)MOD) % MOD);
 
-    template<typename T>
+        explicit StaticMontgomery(uint64_t mod = MOD) {
+            if (mod != MOD) throw invalid_argument("StaticMontgomery: modulus differs from MOD");
+        }
+        static bool supports(uint64_t mod) { return mod == MOD; }
+
+        static uint64_t reduce(unsigned __int128 t) {
+            if constexpr (SMALL) {
+                uint64_t x = (uint64_t)t;
+                uint32_t q = (uint32_t)x * (uint32_t)(0 - INV);         // -MOD^-1 mod 2^32
+                uint64_t r = (x + (uint64_t)q * MOD) >> 32;
+                return r >= MOD ? r - MOD : r;
+            } else {
+                uint64_t q = (uint64_t)t * INV;
+                uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * MOD) >> 64);
+                return a >= b ? a - b : a - b + MOD;
+            }
+        }
+        static constexpr uint64_t mod() { return MOD; }
+        static uint64_t one() { return to(1); }
+        static uint64_t to(uint64_t x) { return reduce((unsigned __int128)(x % MOD) * R2); }
+        static uint64_t from(uint64_t a) { return reduce(a); }
+        static uint64_t mul(uint64_t a, uint64_t b) {
+            if constexpr (SMALL) return reduce(a * b);
+            else return reduce((unsigned __int128)a * b);
+        }
+    };
+#endif
+
+
+
+    template<typename T, typename Reducer = Int128Reducer>
     class SegTreeAdv2D {
         struct Node {
             T gcdVal = 0;
@@ -55,10 +150,17 @@ inline namespace MY{
         int n = 0, m = 0;
         T MOD = (T)1000000007;
         T LCM_CAP = (T(1) << 62);
+        Reducer red{};          // prodMod lives in red's internal form
         vector<Node> nodes;
 
+        static Reducer makeReducer(T mod) {
+            if (mod < 1 || !Reducer::supports((uint64_t)mod)) throw invalid_argument("SegTreeAdv2D: MOD not supported by reducer");
+            return Reducer((uint64_t)mod);
+        }
+
         inline int newNode() {
             nodes.push_back(Node());
+            nodes.back().prodMod = (T)red.one();
             return (int)nodes.size() - 1;
         }
 
@@ -76,15 +178,16 @@ inline namespace MY{
             return (T)t;
         }
 
+        // a^e mod MOD for a normal value a, result in red's internal form
         inline T mod_pow(T a,long long e) const {
-            T r = 1 % MOD;
-            a = (a % MOD + MOD) % MOD;
+            uint64_t r = red.one();
+            uint64_t b = red.to((uint64_t)((a % MOD + MOD) % MOD));
             while (e>0) {
-                if (e&1) r = (__int128)r * a % MOD;
-                a = (__int128)a * a % MOD;
+                if (e&1) r = red.mul(r, b);
+                b = red.mul(b, b);
                 e >>= 1;
             }
-            return r;
+            return (T)r;
         }
 
         void applyAssign(int v,int x1,int x2,int y1,int y2,T val){
@@ -100,7 +203,7 @@ inline namespace MY{
         void pull(int v){
             Node &nd = nodes[v];
             bool any=false;
-            T g=0,L=1,P=1;
+            T g=0,L=1,P=(T)red.one();
             for(int i=0;i<4;i++){
                 int c = nd.child[i];
                 if (c==-1) continue;
@@ -108,7 +211,7 @@ inline namespace MY{
                 Node &C = nodes[c];
                 g = gcdT(g,C.gcdVal);
                 L = lcm_saturate(L,C.lcmVal);
-                P = (__int128)P * C.prodMod % MOD;
+                P = (T)red.mul((uint64_t)P, (uint64_t)C.prodMod);
             }
             if (any){ nd.gcdVal=g; nd.lcmVal=L; nd.prodMod=P; }
         }
@@ -205,15 +308,15 @@ inline namespace MY{
         }
 
         T queryProdMod_rec(int v,int x1,int x2,int y1,int y2,int qx1,int qy1,int qx2,int qy2){
-            if (qx1>x2||qx2<x1||qy1>y2||qy2<y1) return 1 % MOD;
+            if (qx1>x2||qx2<x1||qy1>y2||qy2<y1) return (T)red.one();
             if (qx1<=x1&&x2<=qx2&&qy1<=y1&&y2<=qy2) return nodes[v].prodMod;
             push(v,x1,x2,y1,y2);
             int mx=(x1+x2)>>1,my=(y1+y2)>>1;
-            __int128 P=1;
-            if (x1<=mx && y1<=my && nodes[v].child[0]!=-1) P=P*queryProdMod_rec(nodes[v].child[0],x1,mx,y1,my,qx1,qy1,qx2,qy2)%MOD;
-            if (x1<=mx && my+1<=y2 && nodes[v].child[1]!=-1) P=P*queryProdMod_rec(nodes[v].child[1],x1,mx,my+1,y2,qx1,qy1,qx2,qy2)%MOD;
-            if (mx+1<=x2 && y1<=my && nodes[v].child[2]!=-1) P=P*queryProdMod_rec(nodes[v].child[2],mx+1,x2,y1,my,qx1,qy1,qx2,qy2)%MOD;
-            if (mx+1<=x2 && my+1<=y2 && nodes[v].child[3]!=-1) P=P*queryProdMod_rec(nodes[v].child[3],mx+1,x2,my+1,y2,qx1,qy1,qx2,qy2)%MOD;
+            uint64_t P=red.one();
+            if (x1<=mx && y1<=my && nodes[v].child[0]!=-1) P=red.mul(P,queryProdMod_rec(nodes[v].child[0],x1,mx,y1,my,qx1,qy1,qx2,qy2));
+            if (x1<=mx && my+1<=y2 && nodes[v].child[1]!=-1) P=red.mul(P,queryProdMod_rec(nodes[v].child[1],x1,mx,my+1,y2,qx1,qy1,qx2,qy2));
+            if (mx+1<=x2 && y1<=my && nodes[v].child[2]!=-1) P=red.mul(P,queryProdMod_rec(nodes[v].child[2],mx+1,x2,y1,my,qx1,qy1,qx2,qy2));
+            if (mx+1<=x2 && my+1<=y2 && nodes[v].child[3]!=-1) P=red.mul(P,queryProdMod_rec(nodes[v].child[3],mx+1,x2,my+1,y2,qx1,qy1,qx2,qy2));
             return (T)P;
         }
 
@@ -221,14 +324,14 @@ inline namespace MY{
         SegTreeAdv2D() = default;
 
         SegTreeAdv2D(int N,int M,T fixedMod=(T)1000000007,T lcmCap=(T(1)<<62))
-            :n(N),m(M),MOD(fixedMod),LCM_CAP(lcmCap){
-            nodes.clear(); nodes.push_back(Node());
+            :n(N),m(M),MOD(fixedMod),LCM_CAP(lcmCap),red(makeReducer(fixedMod)){
+            nodes.clear(); newNode();
             if (n&&m) applyAssign(0,0,n-1,0,m-1,0);
         }
 
         SegTreeAdv2D(const vector<vector<T>>& a,T fixedMod=(T)1000000007,T lcmCap=(T(1)<<62))
-            :n((int)a.size()),m(n?(int)a[0].size():0),MOD(fixedMod),LCM_CAP(lcmCap){
-            nodes.clear(); nodes.push_back(Node());
+            :n((int)a.size()),m(n?(int)a[0].size():0),MOD(fixedMod),LCM_CAP(lcmCap),red(makeReducer(fixedMod)){
+            nodes.clear(); newNode();
             if (n&&m) build_rec(0,0,n-1,0,m-1,a);
         }
 
@@ -263,7 +366,7 @@ inline namespace MY{
             x1=max(0,x1); y1=max(0,y1);
             x2=min(n-1,x2); y2=min(m-1,y2);
             if (x1>x2||y1>y2) return 1 % MOD;
-            return queryProdMod_rec(0,0,n-1,0,m-1,x1,y1,x2,y2);
+            return (T)red.from((uint64_t)queryProdMod_rec(0,0,n-1,0,m-1,x1,y1,x2,y2));
         }
 
         T pointQuery(int x,int y){ return rangeGCD(x,y,x,y); }
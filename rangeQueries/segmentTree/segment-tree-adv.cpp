@@ -11,12 +11,14 @@ inline namespace MY{
 
     /*
         ===============================
-        SegTreeAdv1D Class — Function Complexities
+        SegTreeAdv1D<T, Reducer> Class — Function Complexities
         ===============================
 
 
         1. SegTreeAdv1D(n, fixedMod = nullopt)     → Constructor (empty tree)           | Time: O(n) | Space: O(n)
         2. SegTreeAdv1D(arr, fixedMod = nullopt)  → Constructor (from array)          | Time: O(n) | Space: O(n)
+        2a. SegTreeAdv1D(n | arr, mods)            → Same, with K registered moduli     | Time: O(K · n) | Space: O(K · n)
+                                                     (n | arr, {mod}) and (n | arr, mod) register one modulus
 
         3. rangeAssign(L, R, val)                  → Assign val to range [L, R]        | Time: O(log n) | Space: O(1)
         4. pointAssign(pos, val)                   → Assign val to a single index       | Time: O(log n) | Space: O(1)
@@ -24,12 +26,17 @@ inline namespace MY{
         5. rangeGCD(L, R)                          → Query GCD over [L, R]             | Time: O(log n) | Space: O(1)
         6. rangeLCM(L, R)                          → Query LCM over [L, R]             | Time: O(log n) | Space: O(1)
         7. rangeProdMod(L, R, mod)                 → Query product modulo 'mod' over [L, R] 
-                                                    | Time: O(log n) amortized if fixedMod = mod or segment uniform
-                                                    | Worst-case > O(log n) for arbitrary mod
+                                                    | Time: O(log n) if mod is registered (products via Reducer)
+                                                    | or segment uniform; worst-case > O(log n) for arbitrary mod
                                                     | Space: O(1)
 
         8. pointQuery(pos)                          → Query exact element value          | Time: O(log n) | Space: O(log n) (due to push path)
 
+        --- Multithreaded Bulk Operations (results identical to the sequential path) ---
+        8a. initParallel(arr, threads)             → Rebuild with subtrees built concurrently | Time: O(n / threads + threads) | Space: O(n)
+        8b. applyUpdates(updates, threads)         → Apply a batch of Update{L, R, val} assignments in order | Time: O(u · (log n + c) / threads) | Space: O(u)
+                                                    (c = number of the ~4·threads subtrees an update spans)
+
         --- Internal Helpers (for completeness) ---
         9. build(idx, l, r, arr)                   → Build segment tree recursively     | Time: O(n) | Space: O(n)
         10. pull(idx, l, r)                        → Merge child nodes into parent      | Time: O(1) | Space: O(1)
@@ -46,11 +53,156 @@ inline namespace MY{
             pos = index for point operations
             val = assigned value
             mod = modulo value for rangeProdMod
+            mods = registered moduli (fixedMod is the K = 1 case); per-node products for all K
+                  are kept struct-of-arrays, one contiguous slab per modulus, so a query on
+                  modulus k only touches slab k. Assignments cost O(K log len) per node.
+            Reducer = backend for the registered-mod products (Int128Reducer default, BarrettReducer,
+                  MontgomeryReducer, StaticMontgomery<MOD>; see maths/modint.cpp).
+                  Per-node products are kept in its internal form; a registered mod it cannot
+                  handle throws invalid_argument. Unregistered mods use __int128.
+            threads = worker count (0 = hardware_concurrency)
+            u   = number of updates in the batch; applyUpdates on an empty tree throws like SegTree1D's
+
+        Usage Example:
+            SegTreeAdv1D<long long> st(arr, {998244353LL});             // one registered modulus
+            SegTreeAdv1D<long long> multi(arr, {998244353LL, 1000000007LL});
+            SegTreeAdv1D<long long> empty(5, {7LL});
+            long long p = multi.rangeProdMod(2, 9, 1000000007LL);       // served from slab 1
     */
 
 
-    template<typename T>
+#ifndef MOD_REDUCERS_DEFINED
+#define MOD_REDUCERS_DEFINED
+    struct Int128Reducer {
+        uint64_t m;
+        explicit Int128Reducer(uint64_t mod = 1000000007ULL) : m(mod) {}
+        static bool supports(uint64_t mod) { return mod >= 1; }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const { return (uint64_t)((unsigned __int128)a * b % m); }
+    };
+
+    // q = floor(z / m) up to one, from the high half of z · ceil(2^64 / m)
+    struct BarrettReducer {
+        uint64_t m, im;
+        explicit BarrettReducer(uint64_t mod = 998244353ULL) : m(mod), im(~0ULL / mod + 1) {}
+        static bool supports(uint64_t mod) { return mod >= 1 && mod < (1ULL << 32); }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return 1 % m; }
+        uint64_t to(uint64_t x) const { return x % m; }
+        uint64_t from(uint64_t a) const { return a; }
+        uint64_t mul(uint64_t a, uint64_t b) const {
+            uint64_t z = a * b;
+            uint64_t x = (uint64_t)(((unsigned __int128)z * im) >> 64);
+            uint64_t y = x * m;
+            return z - y + (z < y ? m : 0);
+        }
+    };
+
+    // Internal form a · 2^64 mod m; reduce(t) = t · 2^-64 mod m
+    struct MontgomeryReducer {
+        uint64_t m, inv, r2;
+        explicit MontgomeryReducer(uint64_t mod = 1000000007ULL) : m(mod), inv(1) {
+            for (int i = 0; i < 6; ++i) inv *= 2 - mod * inv;          // m^-1 mod 2^64 (Newton)
+            r2 = (uint64_t)(-(unsigned __int128)mod % mod);            // 2^128 mod m
+        }
+        static bool supports(uint64_t mod) { return (mod & 1) && mod < (1ULL << 63); }
+        uint64_t reduce(unsigned __int128 t) const {
+            uint64_t q = (uint64_t)t * inv;
+            uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * m) >> 64);
+            return a >= b ? a - b : a - b + m;
+        }
+        uint64_t mod() const { return m; }
+        uint64_t one() const { return to(1); }
+        uint64_t to(uint64_t x) const { return reduce((unsigned __int128)(x % m) * r2); }
+        uint64_t from(uint64_t a) const { return reduce(a); }
+        uint64_t mul(uint64_t a, uint64_t b) const { return reduce((unsigned __int128)a * b); }
+    };
+
+    // Montgomery with MOD known at compile time; MOD < 2^31 runs entirely in 64-bit registers
+    template <uint64_t MOD>
+    struct StaticMontgomery {
+        static_assert((MOD & 1) && MOD < (1ULL << 63), "StaticMontgomery: MOD must be odd and < 2^63");
+        static constexpr bool SMALL = MOD < (1ULL << 31);
+
+        static constexpr uint64_t inv64() { uint64_t x = 1; for (int i = 0; i < 6; ++i) x *= 2 - MOD * x; return x; }
+        static constexpr uint64_t INV = inv64();
+        // SMALL uses radix 2^32 (R2 = 2^64 mod MOD), otherwise radix 2^64 (R2 = 2^128 mod MOD)
+        static constexpr uint64_t R2 = SMALL ? (uint64_t)((((unsigned __int128)1) << 64) % MOD)
+                                             : (uint64_t)((-(unsigned __int128)MOD) % MOD);
+
+        explicit StaticMontgomery(uint64_t mod = MOD) {
+            if (mod != MOD) throw invalid_argument("StaticMontgomery: modulus differs from MOD");
+        }
+        static bool supports(uint64_t mod) { return mod == MOD; }
+
+        static uint64_t reduce(unsigned __int128 t) {
+            if constexpr (SMALL) {
+                uint64_t x = (uint64_t)t;
+                uint32_t q = (uint32_t)x * (uint32_t)(0 - INV);         // -MOD^-1 mod 2^32
+                uint64_t r = (x + (uint64_t)q * MOD) >> 32;
+                return r >= MOD ? r - MOD : r;
+            } else {
+                uint64_t q = (uint64_t)t * INV;
+                uint64_t a = (uint64_t)(t >> 64), b = (uint64_t)(((unsigned __int128)q * MOD) >> 64);
+                return a >= b ? a - b : a - b + MOD;
+            }
+        }
+        static constexpr uint64_t mod() { return MOD; }
+        static uint64_t one() { return to(1); }
+        static uint64_t to(uint64_t x) { return reduce((unsigned __int128)(x % MOD) * R2); }
+        static uint64_t from(uint64_t a) { return reduce(a); }
+        static uint64_t mul(uint64_t a, uint64_t b) {
+            if constexpr (SMALL) return reduce(a * b);
+            else return reduce((unsigned __int128)a * b);
+        }
+    };
+#endif
+
+
+#ifndef PARALLEL_HELPERS_DEFINED
+#define PARALLEL_HELPERS_DEFINED
+    // Worker count for a `threads` argument: 0 means hardware_concurrency, never below 1
+    inline int resolveThreads(int threads) {
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        return max(1, threads);
+    }
+
+    // Depth of the subtree frontier split among workers, ~4 subtrees per worker for balance
+    inline int frontierDepth(int threads) {
+        int d = 0;
+        while ((1 << d) < 4 * threads) ++d;
+        return d;
+    }
+
+    // Runs job(i) for i in [0, tasks) on `threads` workers, contiguous blocks per worker
+    template <typename Job>
+    void runParallel(int tasks, int threads, Job job) {
+        threads = min(threads, tasks);
+        if (threads <= 1) { for (int i = 0; i < tasks; ++i) job(i); return; }
+        vector<thread> pool;
+        pool.reserve(threads);
+        for (int t = 0; t < threads; ++t) {
+            int from = (int)((long long)tasks * t / threads);
+            int to = (int)((long long)tasks * (t + 1) / threads);
+            pool.emplace_back([from, to, &job]() { for (int i = from; i < to; ++i) job(i); });
+        }
+        for (auto& th : pool) th.join();
+    }
+#endif
+
+
+    template<typename T, typename Reducer = Int128Reducer>
     class SegTreeAdv1D {
+    public:
+        // One entry of a bulk assignment batch (see applyUpdates)
+        struct Update {
+            int L, R;
+            T val;
+        };
+
     private:
         struct Node {
             T gcdVal, lcmVal;
@@ -61,19 +213,25 @@ inline namespace MY{
             bool isUniform;
             T uniformVal;
 
-            // If fixedMod_.has_value(), we keep product modulo fixedMod_ per node
-            T prodFixedMod; // only valid when fixedMod_ is set
-
             Node():
                 gcdVal(0), lcmVal(1),
                 hasAssign(false), assignVal(0),
-                isUniform(false), uniformVal(0),
-                prodFixedMod(1) {}
+                isUniform(false), uniformVal(0) {}
         };
 
         int n_;
         vector<Node> tree_;
-        optional<T> fixedMod_; // if set, we store per-node product modulo this value
+        vector<T> mods_;             // registered moduli, we store per-node product modulo each
+        vector<Reducer> reds_;       // multiplication backend per registered modulus
+        vector<uint64_t> prod_;      // prod_[k * tree_.size() + idx], in reds_[k]'s internal form
+
+        inline int K() const { return (int)mods_.size(); }
+        inline uint64_t& prod(int k, int idx) { return prod_[(size_t)k * tree_.size() + idx]; }
+
+        void resizeStorage(int n) {
+            tree_.assign(4 * max(1, n), Node());
+            prod_.assign(mods_.size() * tree_.size(), 0);
+        }
 
         // ---------- helpers ----------
         static T gcd_combine(T a, T b) {
@@ -105,8 +263,45 @@ inline namespace MY{
             return static_cast<T>(res);
         }
 
+        void registerMods(const vector<T>& mods) {
+            for (T mod : mods) {
+                if (mod < 1 || !Reducer::supports((uint64_t)mod)) throw invalid_argument("SegTreeAdv1D: modulus not supported by reducer");
+                if (find(mods_.begin(), mods_.end(), mod) != mods_.end()) continue;
+                mods_.push_back(mod);
+                reds_.emplace_back((uint64_t)mod);
+            }
+        }
+
+        static vector<T> asList(const optional<T>& mod) {
+            return mod.has_value() ? vector<T>{*mod} : vector<T>{};
+        }
+
+        int slotOf(T mod) const {
+            for (int k = 0; k < K(); ++k) if (mods_[k] == mod) return k;
+            return -1;
+        }
+
+        // val mod mods_[k], converted to reds_[k]'s internal form
+        uint64_t toFixed(int k, T val) const {
+            T M = mods_[k];
+            T v = val % M;
+            if (v < 0) v += M;
+            return reds_[k].to((uint64_t)v);
+        }
+
+        uint64_t pow_fixed(int k, uint64_t base, long long exp) const {
+            const Reducer& red = reds_[k];
+            uint64_t res = red.one();
+            while (exp > 0) {
+                if (exp & 1) res = red.mul(res, base);
+                base = red.mul(base, base);
+                exp >>= 1;
+            }
+            return res;
+        }
+
         static T pow_nosafe(T base, long long exp) {
-            // Only used when computing uniform segment product for fixedMod_ already handled elsewhere.
+            // Only used when computing uniform segment product for registered mods already handled elsewhere.
             // Not used for raw product storage (we don't store raw product).
             // Kept here for completeness; avoid calling this for big exponents without a modulus.
             __int128 b = base;
@@ -122,6 +317,10 @@ inline namespace MY{
         inline int left(int idx) const { return idx << 1; }
         inline int right(int idx) const { return (idx << 1) | 1; }
 
+        void ensure_not_empty() const {
+            if (n_ == 0) throw runtime_error("SegTreeAdv1D: operation on empty tree");
+        }
+
         void pull(int idx, int l, int r) {
             Node &L = tree_[left(idx)], &R = tree_[right(idx)];
             Node &X = tree_[idx];
@@ -138,11 +337,9 @@ inline namespace MY{
                 X.uniformVal = 0;
             }
 
-            // If a fixed modulus is set, maintain product modulo it
-            if (fixedMod_.has_value()) {
-                T M = *fixedMod_;
-                X.prodFixedMod = ( (__int128)L.prodFixedMod * R.prodFixedMod ) % M;
-            }
+            // Maintain the product modulo every registered modulus
+            for (int k = 0; k < K(); ++k)
+                prod(k, idx) = reds_[k].mul(prod(k, left(idx)), prod(k, right(idx)));
 
             // Parent is not a pending assign unless explicitly set
             X.hasAssign = false;
@@ -161,11 +358,8 @@ inline namespace MY{
             X.gcdVal = val;
             X.lcmVal = val;
 
-            if (fixedMod_.has_value()) {
-                T M = *fixedMod_;
-                long long len = r - l + 1;
-                X.prodFixedMod = pow_mod(val, len, M);
-            }
+            long long len = r - l + 1;
+            for (int k = 0; k < K(); ++k) prod(k, idx) = pow_fixed(k, toFixed(k, val), len);
         }
 
         void push(int idx, int l, int r) {
@@ -187,10 +381,7 @@ inline namespace MY{
                 X.uniformVal = v;
                 X.hasAssign = false;
                 X.assignVal = 0;
-                if (fixedMod_.has_value()) {
-                    T M = *fixedMod_;
-                    X.prodFixedMod = v % M;
-                }
+                for (int k = 0; k < K(); ++k) prod(k, idx) = toFixed(k, v);
                 return;
             }
             int mid = (l + r) >> 1;
@@ -234,9 +425,18 @@ inline namespace MY{
             return lcm_safe(a, b);
         }
 
-        // Product modulo 'mod' — smart handling:
+        // Product modulo mods_[k] in reds_[k]'s internal form; every fully covered node is O(1)
+        uint64_t rangeProdFixed(int k, int idx, int l, int r, int L, int R) {
+            if (R < l || r < L) return reds_[k].one();
+            if (L <= l && r <= R) return prod(k, idx);
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            return reds_[k].mul(rangeProdFixed(k, left(idx), l, mid, L, R),
+                                rangeProdFixed(k, right(idx), mid + 1, r, L, R));
+        }
+
+        // Product modulo an unregistered 'mod' (registered ones go through rangeProdFixed):
         // - If full cover and node is uniform => pow_mod(uniformVal, len, mod) in O(log len)
-        // - Else if full cover and fixedMod is set and mod == fixedMod => return stored O(1)
         // - Else recurse. (Worst-case may exceed O(log n) for arbitrary mod requests.)
         T rangeProdMod(int idx, int l, int r, int L, int R, T mod) {
             if (mod == T(1)) return T(0); // anything mod 1 is 0
@@ -247,9 +447,6 @@ inline namespace MY{
                 if (X.isUniform) {
                     return pow_mod(X.uniformVal % mod, len, mod);
                 }
-                if (fixedMod_.has_value() && (*fixedMod_) == mod) {
-                    return X.prodFixedMod; // O(1) when using fixed storage
-                }
                 // fall through: need to split
             }
             push(idx, l, r);
@@ -270,21 +467,104 @@ inline namespace MY{
             return pointQuery(right(idx), mid + 1, r, pos);
         }
 
+        // ---------- multithreading helpers ----------
+        struct Frontier { int idx, l, r; };
+
+        void collectFrontier(int idx, int l, int r, int depth, int target, vector<Frontier>& out) const {
+            if (depth == target || l == r) { out.push_back({idx, l, r}); return; }
+            int mid = (l + r) >> 1;
+            collectFrontier(left(idx), l, mid, depth + 1, target, out);
+            collectFrontier(right(idx), mid + 1, r, depth + 1, target, out);
+        }
+
+        // Push every assignment above the frontier so that frontier subtrees are self-contained
+        void pushTop(int idx, int l, int r, int depth, int target) {
+            if (depth == target || l == r) return;
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            pushTop(left(idx), l, mid, depth + 1, target);
+            pushTop(right(idx), mid + 1, r, depth + 1, target);
+        }
+
+        void pullTop(int idx, int l, int r, int depth, int target) {
+            if (depth == target || l == r) return;
+            int mid = (l + r) >> 1;
+            pullTop(left(idx), l, mid, depth + 1, target);
+            pullTop(right(idx), mid + 1, r, depth + 1, target);
+            pull(idx, l, r);
+        }
+
     public:
         // Construct empty tree of size n (values initialized to 0)
         explicit SegTreeAdv1D(int n, optional<T> fixedMod = nullopt)
-            : n_(n), tree_(4 * n), fixedMod_(fixedMod) {
-            vector<T> arr(n_, T(0));
-            build(1, 0, n_ - 1, arr);
-        }
+            : SegTreeAdv1D(n, asList(fixedMod)) {}
 
         // Construct from array
         explicit SegTreeAdv1D(const vector<T>& arr, optional<T> fixedMod = nullopt)
-            : n_(static_cast<int>(arr.size())), tree_(4 * max(1, (int)arr.size())), fixedMod_(fixedMod) {
+            : SegTreeAdv1D(arr, asList(fixedMod)) {}
+
+        // One registered modulus; an exact match, so (n | arr, {mod}) resolves here instead of
+        // being ambiguous between the optional and the list overloads
+        SegTreeAdv1D(int n, T fixedMod) : SegTreeAdv1D(n, vector<T>{fixedMod}) {}
+        SegTreeAdv1D(const vector<T>& arr, T fixedMod) : SegTreeAdv1D(arr, vector<T>{fixedMod}) {}
+
+        // Construct empty tree with K registered moduli (duplicates are ignored)
+        SegTreeAdv1D(int n, const vector<T>& mods) : n_(n) {
+            registerMods(mods);
+            resizeStorage(n_);
+            vector<T> arr(n_, T(0));
+            if (n_ > 0) build(1, 0, n_ - 1, arr);
+        }
+
+        // Construct from array with K registered moduli
+        SegTreeAdv1D(const vector<T>& arr, const vector<T>& mods) : n_(static_cast<int>(arr.size())) {
+            registerMods(mods);
+            resizeStorage(n_);
             if (n_ == 0) return;
             build(1, 0, n_ - 1, arr);
         }
 
+        // Rebuild from arr (registered mods are kept); independent subtrees are built on separate threads
+        void initParallel(const vector<T>& arr, int threads = 0) {
+            threads = resolveThreads(threads);
+            n_ = static_cast<int>(arr.size());
+            resizeStorage(n_);
+            if (n_ == 0) return;
+            int target = frontierDepth(threads);
+            vector<Frontier> fr;
+            collectFrontier(1, 0, n_ - 1, 0, target, fr);
+            runParallel((int)fr.size(), threads, [&](int i) { build(fr[i].idx, fr[i].l, fr[i].r, arr); });
+            pullTop(1, 0, n_ - 1, 0, target);
+        }
+
+        // Applies assignments in batch order; pieces falling into different subtrees run concurrently
+        void applyUpdates(const vector<Update>& updates, int threads = 0) {
+            ensure_not_empty();
+            threads = resolveThreads(threads);
+            int target = frontierDepth(threads);
+            vector<Frontier> fr;
+            collectFrontier(1, 0, n_ - 1, 0, target, fr);
+            int k = (int)fr.size();
+
+            // Stable partition: bucket[c] keeps, in batch order, the pieces clipped to subtree c
+            vector<vector<Update>> bucket(k);
+            for (const Update& u : updates) {
+                int L = max(0, u.L), R = min(n_ - 1, u.R);
+                if (L > R) continue;
+                int c = int(upper_bound(fr.begin(), fr.end(), L,
+                            [](int pos, const Frontier& f) { return pos < f.l; }) - fr.begin()) - 1;
+                for (; c < k && fr[c].l <= R; ++c)
+                    bucket[c].push_back({max(L, fr[c].l), min(R, fr[c].r), u.val});
+            }
+
+            pushTop(1, 0, n_ - 1, 0, target);
+            runParallel(k, threads, [&](int c) {
+                for (const Update& u : bucket[c])
+                    rangeAssign(fr[c].idx, fr[c].l, fr[c].r, u.L, u.R, u.val);
+            });
+            pullTop(1, 0, n_ - 1, 0, target);
+        }
+
         // Updates
         void rangeAssign(int L, int R, T val) {
             if (L > R) return;
@@ -305,6 +585,8 @@ inline namespace MY{
         }
         T rangeProdMod(int L, int R, T mod) {
             if (L > R) return T(1 % (mod == 0 ? 1 : mod));
+            int k = slotOf(mod);
+            if (k >= 0) return (T)reds_[k].from(rangeProdFixed(k, 1, 0, n_ - 1, L, R));
             return rangeProdMod(1, 0, n_ - 1, L, R, mod);
         }
         T pointQuery(int pos) {
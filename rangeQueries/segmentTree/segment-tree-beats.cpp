@@ -0,0 +1,242 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        SegTreeBeats Class — Function Complexities
+        ===============================
+
+        Segment Tree Beats (Ji Ruyi): every node keeps the maximum, the strict second
+        maximum and the count of the maximum (and the min mirror), so a clamp only
+        has to descend into nodes where it actually changes more than one distinct value.
+
+        1. SegTreeBeats(n)                         → Constructor (all zeros)    | Time: O(n) | Space: O(n)
+        2. SegTreeBeats(arr)                       → Constructor (from array)   | Time: O(n) | Space: O(n)
+        3. init(arr)                               → Initialize/rebuild tree    | Time: O(n) | Space: O(n)
+
+        4. rangeChmin(L, R, x)                     → a[i] = min(a[i], x) on [L, R] | Time: O(log^2 n) amortized | Space: O(1)
+        5. rangeChmax(L, R, x)                     → a[i] = max(a[i], x) on [L, R] | Time: O(log^2 n) amortized | Space: O(1)
+        6. rangeAdd(L, R, val)                     → Add val to range [L, R]       | Time: O(log n)   | Space: O(1)
+        7. pointAssign(pos, val)                   → Assign val to single index    | Time: O(log n)   | Space: O(1)
+
+        8. rangeSum(L, R)                          → Query sum over [L, R]         | Time: O(log n) | Space: O(1)
+        9. rangeMin(L, R)                          → Query minimum over [L, R]     | Time: O(log n) | Space: O(1)
+        10. rangeMax(L, R)                         → Query maximum over [L, R]     | Time: O(log n) | Space: O(1)
+        11. pointQuery(pos)                        → Query exact element value     | Time: O(log n) | Space: O(1)
+
+        --- Internal Helpers (for completeness) ---
+        12. pull(idx)                              → Merge max/2nd max/count (and min mirror) | Time: O(1)
+        13. push(idx, l, r)                        → Propagate add tag, then clamp children to parent max/min | Time: O(1)
+        14. applyAdd(idx, len, val)                → Add val to whole node      | Time: O(1)
+        15. applyChmin(idx, x) / applyChmax(idx, x)→ Clamp node whose 2nd max < x < max (resp. min mirror) | Time: O(1)
+
+        Where:
+            n   = number of elements in the array
+            L,R = query/update range boundaries (0-based indices)
+            x   = clamp bound
+    */
+
+
+    template <typename T>
+    class SegTreeBeats {
+    private:
+        static constexpr T NEG = numeric_limits<T>::lowest();
+        static constexpr T POS = numeric_limits<T>::max();
+
+        struct Node {
+            T sum;
+            T mx1, mx2; int cntMx;   // max, strict second max, count of max
+            T mn1, mn2; int cntMn;   // min, strict second min, count of min
+            T add;                   // lazy add
+            Node(): sum(0), mx1(NEG), mx2(NEG), cntMx(0), mn1(POS), mn2(POS), cntMn(0), add(0) {}
+        };
+
+        int n = 0;
+        vector<Node> tree;
+
+        void ensure_not_empty() const {
+            if (n == 0) throw runtime_error("SegTreeBeats: operation on empty tree");
+        }
+
+        void setLeaf(int idx, T val) {
+            Node &X = tree[idx];
+            X.sum = val;
+            X.mx1 = X.mn1 = val;
+            X.mx2 = NEG; X.mn2 = POS;
+            X.cntMx = X.cntMn = 1;
+            X.add = 0;
+        }
+
+        void pull(int idx) {
+            const Node &L = tree[idx<<1], &R = tree[idx<<1|1];
+            Node &X = tree[idx];
+            X.sum = (T)((__int128)L.sum + R.sum);
+
+            if (L.mx1 == R.mx1) {
+                X.mx1 = L.mx1; X.cntMx = L.cntMx + R.cntMx; X.mx2 = max(L.mx2, R.mx2);
+            } else if (L.mx1 > R.mx1) {
+                X.mx1 = L.mx1; X.cntMx = L.cntMx; X.mx2 = max(L.mx2, R.mx1);
+            } else {
+                X.mx1 = R.mx1; X.cntMx = R.cntMx; X.mx2 = max(L.mx1, R.mx2);
+            }
+
+            if (L.mn1 == R.mn1) {
+                X.mn1 = L.mn1; X.cntMn = L.cntMn + R.cntMn; X.mn2 = min(L.mn2, R.mn2);
+            } else if (L.mn1 < R.mn1) {
+                X.mn1 = L.mn1; X.cntMn = L.cntMn; X.mn2 = min(L.mn2, R.mn1);
+            } else {
+                X.mn1 = R.mn1; X.cntMn = R.cntMn; X.mn2 = min(L.mn1, R.mn2);
+            }
+        }
+
+        void applyAdd(int idx, int len, T val) {
+            Node &X = tree[idx];
+            X.sum = (T)((__int128)X.sum + (__int128)val * len);
+            X.mx1 += val; X.mn1 += val;
+            if (X.mx2 != NEG) X.mx2 += val;
+            if (X.mn2 != POS) X.mn2 += val;
+            X.add += val;
+        }
+
+        // Requires mx2 < x < mx1: only the maximum values change.
+        void applyChmin(int idx, T x) {
+            Node &X = tree[idx];
+            X.sum = (T)((__int128)X.sum - (__int128)(X.mx1 - x) * X.cntMx);
+            if (X.mx1 == X.mn1) X.mn1 = x;          // node holds a single distinct value
+            else if (X.mx1 == X.mn2) X.mn2 = x;     // node holds exactly two distinct values
+            X.mx1 = x;
+        }
+
+        // Requires mn1 < x < mn2: only the minimum values change.
+        void applyChmax(int idx, T x) {
+            Node &X = tree[idx];
+            X.sum = (T)((__int128)X.sum + (__int128)(x - X.mn1) * X.cntMn);
+            if (X.mn1 == X.mx1) X.mx1 = x;
+            else if (X.mn1 == X.mx2) X.mx2 = x;
+            X.mn1 = x;
+        }
+
+        void push(int idx, int l, int r) {
+            if (l == r) return;
+            int mid = (l + r) >> 1;
+            Node &X = tree[idx];
+            if (X.add != 0) {
+                applyAdd(idx<<1, mid - l + 1, X.add);
+                applyAdd(idx<<1|1, r - mid, X.add);
+                X.add = 0;
+            }
+            for (int c : {idx<<1, idx<<1|1}) {
+                if (tree[c].mx1 > X.mx1) applyChmin(c, X.mx1);
+                if (tree[c].mn1 < X.mn1) applyChmax(c, X.mn1);
+            }
+        }
+
+        void build(int idx, int l, int r, const vector<T>& arr) {
+            if (l == r) { setLeaf(idx, arr.empty() ? T(0) : arr[l]); return; }
+            int mid = (l + r) >> 1;
+            build(idx<<1, l, mid, arr);
+            build(idx<<1|1, mid+1, r, arr);
+            tree[idx].add = 0;
+            pull(idx);
+        }
+
+        void rangeChmin(int idx, int l, int r, int L, int R, T x) {
+            if (R < l || r < L || tree[idx].mx1 <= x) return;
+            if (L <= l && r <= R && tree[idx].mx2 < x) { applyChmin(idx, x); return; }
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            rangeChmin(idx<<1, l, mid, L, R, x);
+            rangeChmin(idx<<1|1, mid+1, r, L, R, x);
+            pull(idx);
+        }
+
+        void rangeChmax(int idx, int l, int r, int L, int R, T x) {
+            if (R < l || r < L || tree[idx].mn1 >= x) return;
+            if (L <= l && r <= R && tree[idx].mn2 > x) { applyChmax(idx, x); return; }
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            rangeChmax(idx<<1, l, mid, L, R, x);
+            rangeChmax(idx<<1|1, mid+1, r, L, R, x);
+            pull(idx);
+        }
+
+        void rangeAdd(int idx, int l, int r, int L, int R, T val) {
+            if (R < l || r < L) return;
+            if (L <= l && r <= R) { applyAdd(idx, r - l + 1, val); return; }
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            rangeAdd(idx<<1, l, mid, L, R, val);
+            rangeAdd(idx<<1|1, mid+1, r, L, R, val);
+            pull(idx);
+        }
+
+        void pointAssign(int idx, int l, int r, int pos, T val) {
+            if (l == r) { setLeaf(idx, val); return; }
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            if (pos <= mid) pointAssign(idx<<1, l, mid, pos, val);
+            else pointAssign(idx<<1|1, mid+1, r, pos, val);
+            pull(idx);
+        }
+
+        T rangeSum(int idx, int l, int r, int L, int R) {
+            if (R < l || r < L) return T(0);
+            if (L <= l && r <= R) return tree[idx].sum;
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            __int128 left = rangeSum(idx<<1, l, mid, L, R);
+            __int128 right = rangeSum(idx<<1|1, mid+1, r, L, R);
+            return (T)(left + right);
+        }
+
+        T rangeMin(int idx, int l, int r, int L, int R) {
+            if (R < l || r < L) return POS;
+            if (L <= l && r <= R) return tree[idx].mn1;
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            return min(rangeMin(idx<<1, l, mid, L, R), rangeMin(idx<<1|1, mid+1, r, L, R));
+        }
+
+        T rangeMax(int idx, int l, int r, int L, int R) {
+            if (R < l || r < L) return NEG;
+            if (L <= l && r <= R) return tree[idx].mx1;
+            push(idx, l, r);
+            int mid = (l + r) >> 1;
+            return max(rangeMax(idx<<1, l, mid, L, R), rangeMax(idx<<1|1, mid+1, r, L, R));
+        }
+
+    public:
+        // --- Constructors ---
+        SegTreeBeats(int n_ = 0): n(n_) {
+            if (n > 0) {
+                tree.assign(4 * n, Node());
+                build(1, 0, n-1, {});
+            }
+        }
+        SegTreeBeats(const vector<T>& arr){ init(arr); }
+
+        void init(const vector<T>& arr){
+            n = (int)arr.size();
+            tree.assign(4 * max(1,n), Node());
+            if (n > 0) build(1, 0, n-1, arr);
+        }
+
+        // --- Public API ---
+        void rangeChmin(int L, int R, T x){ ensure_not_empty(); rangeChmin(1,0,n-1,L,R,x); }
+        void rangeChmax(int L, int R, T x){ ensure_not_empty(); rangeChmax(1,0,n-1,L,R,x); }
+        void rangeAdd(int L, int R, T val){ ensure_not_empty(); rangeAdd(1,0,n-1,L,R,val); }
+        void pointAssign(int pos, T val){ ensure_not_empty(); pointAssign(1,0,n-1,pos,val); }
+
+        T rangeSum(int L, int R){ ensure_not_empty(); return rangeSum(1,0,n-1,L,R); }
+        T rangeMin(int L, int R){ ensure_not_empty(); return rangeMin(1,0,n-1,L,R); }
+        T rangeMax(int L, int R){ ensure_not_empty(); return rangeMax(1,0,n-1,L,R); }
+        T pointQuery(int pos){ ensure_not_empty(); return rangeSum(1,0,n-1,pos,pos); }
+    };
+}
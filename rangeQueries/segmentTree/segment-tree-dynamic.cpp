@@ -0,0 +1,202 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        DynamicSegTree Class — Function Complexities
+        ===============================
+
+        Implicit segment tree over the coordinate range [0, U) (default U = 2^62),
+        so sparse 64-bit keys can be used online without coordinate compression.
+        Nodes are created lazily on update and live in a pooled, index-linked store
+        (vector<Node>, child index 0 = "absent" = all-zero segment). Call reserve()
+        with the expected node count so that ingestion never reallocates in the hot path.
+
+        1. DynamicSegTree(U = 2^62)                → Constructor, all values 0 on [0, U) | Time: O(1) | Space: O(1)
+        2. reserve(nodes)                          → Pre-size the node pool            | Time: O(nodes) | Space: O(nodes)
+        3. clear()                                 → Reset to all zeros (keeps capacity)| Time: O(1)
+
+        4. rangeAssign(L, R, val)                  → Assign val to range [L, R] | Time: O(log U) | Space: O(log U) new nodes
+        5. rangeAdd(L, R, val)                     → Add val to range [L, R]    | Time: O(log U) | Space: O(log U) new nodes
+        6. pointAssign(pos, val)                   → Assign val to single index | Time: O(log U) | Space: O(log U) new nodes
+        7. pointAdd(pos, val)                      → Add val to single index    | Time: O(log U) | Space: O(log U) new nodes
+
+        8. rangeSum(L, R)                          → Query sum over [L, R]      | Time: O(log U) | Space: O(1)
+        9. rangeMin(L, R)                          → Query minimum over [L, R]  | Time: O(log U) | Space: O(1)
+        10. rangeMax(L, R)                         → Query maximum over [L, R]  | Time: O(log U) | Space: O(1)
+        11. pointQuery(pos)                        → Query exact element value  | Time: O(log U) | Space: O(1)
+        12. nodeCount()                            → Nodes allocated so far     | Time: O(1)
+
+        Where:
+            U   = size of the coordinate universe (positions are long long in [0, U))
+            L,R = 0-based inclusive coordinates
+            Each update allocates at most ~4 log2(U) nodes (≈ 250 for U = 2^62).
+            Sums over huge ranges are computed through __int128 and cast back to T.
+    */
+
+
+    template <typename T>
+    class DynamicSegTree {
+    private:
+        struct Node {
+            T sum, mn, mx;
+            T add;        // lazy add
+            T assignVal;  // lazy assignment
+            bool hasAssign;
+            int lc, rc;   // child indices, 0 = absent (all zeros)
+            Node():
+                sum(0), mn(0), mx(0), add(0), assignVal(0), hasAssign(false), lc(0), rc(0) {}
+        };
+
+        long long U;
+        vector<Node> pool;    // pool[0] unused sentinel, pool[1] = root
+
+        inline int newNode() {
+            pool.emplace_back();
+            return (int)pool.size() - 1;
+        }
+
+        void applyAssign(int idx, long long len, T val) {
+            Node &X = pool[idx];
+            X.sum = (T)((__int128)val * len);
+            X.mn = X.mx = val;
+            X.assignVal = val;
+            X.hasAssign = true;
+            X.add = 0;
+        }
+
+        void applyAdd(int idx, long long len, T val) {
+            Node &X = pool[idx];
+            X.sum = (T)((__int128)X.sum + (__int128)val * len);
+            X.mn += val;
+            X.mx += val;
+            if (X.hasAssign) X.assignVal += val;
+            else X.add += val;
+        }
+
+        // Materialize both children, then hand down pending tags
+        void push(int idx, long long l, long long r) {
+            long long mid = l + ((r - l) >> 1);
+            if (pool[idx].lc == 0) { int c = newNode(); pool[idx].lc = c; }
+            if (pool[idx].rc == 0) { int c = newNode(); pool[idx].rc = c; }
+            Node &X = pool[idx];
+            int lc = X.lc, rc = X.rc;
+            if (X.hasAssign) {
+                T v = X.assignVal;
+                X.hasAssign = false;
+                applyAssign(lc, mid - l + 1, v);
+                applyAssign(rc, r - mid, v);
+            }
+            if (pool[idx].add != 0) {
+                T v = pool[idx].add;
+                pool[idx].add = 0;
+                applyAdd(lc, mid - l + 1, v);
+                applyAdd(rc, r - mid, v);
+            }
+        }
+
+        void pull(int idx) {
+            Node &X = pool[idx];
+            const Node &L = pool[X.lc], &R = pool[X.rc];
+            X.sum = (T)((__int128)L.sum + (__int128)R.sum);
+            X.mn = min(L.mn, R.mn);
+            X.mx = max(L.mx, R.mx);
+        }
+
+        void rangeAssign(int idx, long long l, long long r, long long L, long long R, T val) {
+            if (R < l || r < L) return;
+            if (L <= l && r <= R) { applyAssign(idx, r - l + 1, val); return; }
+            push(idx, l, r);
+            long long mid = l + ((r - l) >> 1);
+            rangeAssign(pool[idx].lc, l, mid, L, R, val);
+            rangeAssign(pool[idx].rc, mid + 1, r, L, R, val);
+            pull(idx);
+        }
+
+        void rangeAdd(int idx, long long l, long long r, long long L, long long R, T val) {
+            if (R < l || r < L) return;
+            if (L <= l && r <= R) { applyAdd(idx, r - l + 1, val); return; }
+            push(idx, l, r);
+            long long mid = l + ((r - l) >> 1);
+            rangeAdd(pool[idx].lc, l, mid, L, R, val);
+            rangeAdd(pool[idx].rc, mid + 1, r, L, R, val);
+            pull(idx);
+        }
+
+        enum Kind { SUM, MIN, MAX };
+
+        static T combine(Kind kind, T a, T b) {
+            if (kind == SUM) return (T)((__int128)a + b);
+            return kind == MIN ? min(a, b) : max(a, b);
+        }
+
+        // Queries never allocate: an absent child is an all-zero segment, and the
+        // pending tags of a partially covered node are folded in on the way up.
+        T query(int idx, long long l, long long r, long long L, long long R, Kind kind) const {
+            if (R < l || r < L) {
+                if (kind == SUM) return T(0);
+                return kind == MIN ? numeric_limits<T>::max() : numeric_limits<T>::lowest();
+            }
+            long long cnt = min(r, R) - max(l, L) + 1;
+            if (idx == 0) return T(0);
+            const Node &X = pool[idx];
+            if (L <= l && r <= R) return kind == SUM ? X.sum : (kind == MIN ? X.mn : X.mx);
+            if (X.hasAssign) return kind == SUM ? (T)((__int128)X.assignVal * cnt) : X.assignVal;
+            long long mid = l + ((r - l) >> 1);
+            T res = combine(kind, query(X.lc, l, mid, L, R, kind), query(X.rc, mid + 1, r, L, R, kind));
+            if (kind == SUM) return (T)((__int128)res + (__int128)X.add * cnt);
+            return res + X.add;
+        }
+
+        void ensure_range(long long L, long long R) const {
+            if (L < 0 || R >= U) throw out_of_range("DynamicSegTree: coordinate out of range");
+        }
+
+    public:
+        explicit DynamicSegTree(long long universe = (1LL << 62)) : U(universe) {
+            if (U <= 0) throw invalid_argument("DynamicSegTree: universe must be positive");
+            clear();
+        }
+
+        void reserve(size_t nodes) { pool.reserve(nodes + 2); }
+
+        void clear() {
+            pool.clear();
+            pool.emplace_back();   // sentinel
+            pool.emplace_back();   // root
+        }
+
+        size_t nodeCount() const { return pool.size() - 1; }
+
+        // --- Updates ---
+        void rangeAssign(long long L, long long R, T val){ if (L > R) return; ensure_range(L, R); rangeAssign(1, 0, U - 1, L, R, val); }
+        void rangeAdd(long long L, long long R, T val){ if (L > R) return; ensure_range(L, R); rangeAdd(1, 0, U - 1, L, R, val); }
+        void pointAssign(long long pos, T val){ rangeAssign(pos, pos, val); }
+        void pointAdd(long long pos, T val){ rangeAdd(pos, pos, val); }
+
+        // --- Queries ---
+        T rangeSum(long long L, long long R) const {
+            if (L > R) return T(0);
+            ensure_range(L, R);
+            return query(1, 0, U - 1, L, R, SUM);
+        }
+        T rangeMin(long long L, long long R) const {
+            if (L > R) return numeric_limits<T>::max();
+            ensure_range(L, R);
+            return query(1, 0, U - 1, L, R, MIN);
+        }
+        T rangeMax(long long L, long long R) const {
+            if (L > R) return numeric_limits<T>::lowest();
+            ensure_range(L, R);
+            return query(1, 0, U - 1, L, R, MAX);
+        }
+        T pointQuery(long long pos) const { return rangeSum(pos, pos); }
+    };
+}
@@ -0,0 +1,331 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        SegTree1DIter Class — Function Complexities
+        ===============================
+
+        Drop-in replacement for SegTree1D (same public API), implemented bottom-up
+        over a power-of-two array. No recursion: lazy tags are pushed only along the
+        two boundary paths (L and R) before an operation, and parents are pulled
+        along the same two paths afterwards.
+
+        1. SegTree1DIter(n)                        → Constructor (empty tree) | Time: O(n) | Space: O(n)
+        2. SegTree1DIter(arr)                      → Constructor (from array) | Time: O(n) | Space: O(n)
+        3. init(arr)                               → Initialize/rebuild tree  | Time: O(n) | Space: O(n)
+
+        4. rangeAssign(L, R, val)                  → Assign val to range [L, R] | Time: O(log n) | Space: O(1)
+        5. rangeAdd(L, R, val)                     → Add val to range [L, R]    | Time: O(log n) | Space: O(1)
+        6. pointAssign(pos, val)                   → Assign val to single index | Time: O(log n) | Space: O(1)
+        7. pointAdd(pos, val)                      → Add val to single index    | Time: O(log n) | Space: O(1)
+
+        8. rangeSum(L, R)                          → Query sum over [L, R]      | Time: O(log n) | Space: O(1)
+        9. rangeMin(L, R)                          → Query minimum over [L, R]  | Time: O(log n) | Space: O(1)
+        10. rangeMax(L, R)                         → Query maximum over [L, R]  | Time: O(log n) | Space: O(1)
+        11. pointQuery(pos)                        → Query exact element value  | Time: O(log n) | Space: O(1)
+
+        --- Tree Descent (same contract as SegTree1D) ---
+        12. maxRight(L, pred)                      → Largest R with pred(summary[L..R]) true, L-1 if none  | Time: O(log n) | Space: O(1)
+        13. minLeft(R, pred)                       → Smallest L with pred(summary[L..R]) true, R+1 if none | Time: O(log n) | Space: O(1)
+        14. findFirstBelow(L, x)                   → First index >= L with value < x, -1 if none         | Time: O(log n) | Space: O(1)
+        15. findKthPrefix(k)                       → First index whose prefix sum >= k, -1 if none       | Time: O(log n) | Space: O(1)
+
+        --- Internal Helpers (for completeness) ---
+        16. pull(idx)                              → Merge child nodes          | Time: O(1) | Space: O(1)
+        17. push(idx)                              → Propagate lazy updates     | Time: O(1) | Space: O(1)
+        18. pushBounds(l, r) / pullBounds(l, r)    → Push/pull the two boundary paths | Time: O(log n) | Space: O(1)
+        19. applyAssign(idx, val)                  → Apply assignment lazily    | Time: O(1) | Space: O(1)
+        20. applyAdd(idx, val)                     → Apply addition lazily      | Time: O(1) | Space: O(1)
+
+        --- Overall Complexity Summary ---
+        Build Time: O(n)
+        Per-Operation (Update/Query): O(log n), iterative
+        Space Complexity: O(2 * 2^ceil(log2 n)) ≈ O(n)
+
+        Where:
+            n   = number of elements in the array
+            L,R = query/update range boundaries (0-based indices, clamped to [0, n-1] as in SegTree1D)
+            pos = index for point operations
+            val = assigned or added value
+    */
+
+
+    template <typename T>
+    class SegTree1DIter {
+    public:
+        // Aggregate of a contiguous range, passed to descent predicates
+        struct Summary {
+            T sum, mn, mx;
+            int len;
+            Summary(): sum(0), mn(numeric_limits<T>::max()), mx(numeric_limits<T>::lowest()), len(0) {}
+            Summary(T s, T a, T b, int l): sum(s), mn(a), mx(b), len(l) {}
+        };
+
+    private:
+        struct Node {
+            T sum, mn, mx;
+            T add;        // lazy add
+            T assignVal;  // lazy assignment
+            bool hasAssign;
+            int sz;
+            Node():
+                sum(0), mn(numeric_limits<T>::max()), mx(numeric_limits<T>::lowest()),
+                add(0), assignVal(0), hasAssign(false), sz(0) {}
+        };
+
+        int n = 0;
+        int size = 1;       // number of leaves (power of two >= n)
+        int lg = 0;         // log2(size)
+        vector<Node> tree;  // tree[1] = root, leaves at [size, 2*size)
+
+        void ensure_not_empty() const {
+            if (n == 0) throw runtime_error("SegTree1DIter: operation on empty tree");
+        }
+
+        void applyAssign(int idx, T val){
+            if (tree[idx].sz == 0) return;     // padding leaf beyond n
+            __int128_t tmp = (__int128_t)val * tree[idx].sz;
+            tree[idx].sum = (T)tmp;            // safe from overflow
+            tree[idx].mn = tree[idx].mx = val;
+            tree[idx].assignVal = val;
+            tree[idx].hasAssign = true;
+            tree[idx].add = 0;
+        }
+
+        void applyAdd(int idx, T val) {
+            if (tree[idx].sz == 0) return;
+            if (tree[idx].hasAssign) {
+                tree[idx].assignVal += val;
+                T newVal = tree[idx].assignVal;
+                __int128_t tmp = (__int128_t)newVal * tree[idx].sz;
+                tree[idx].sum = (T)tmp;
+                tree[idx].mn = tree[idx].mx = newVal;
+                return;
+            }
+
+            tree[idx].add += val;
+            __int128_t tmp = (__int128_t)tree[idx].sum + (__int128_t)val * tree[idx].sz;
+            tree[idx].sum = (T)tmp;
+
+            if (tree[idx].mn != numeric_limits<T>::max())
+                tree[idx].mn += val;
+            if (tree[idx].mx != numeric_limits<T>::lowest())
+                tree[idx].mx += val;
+        }
+
+        void push(int idx){
+            if (tree[idx].hasAssign){
+                applyAssign(idx<<1, tree[idx].assignVal);
+                applyAssign(idx<<1|1, tree[idx].assignVal);
+                tree[idx].hasAssign = false;
+            }
+            if (tree[idx].add != 0){
+                T v = tree[idx].add;
+                applyAdd(idx<<1, v);
+                applyAdd(idx<<1|1, v);
+                tree[idx].add = 0;
+            }
+        }
+
+        void pull(int idx){
+            const Node &L = tree[idx<<1], &R = tree[idx<<1|1];
+            tree[idx].sz = L.sz + R.sz;
+            __int128 tmp = (__int128)L.sum + (__int128)R.sum;
+            tree[idx].sum = (T)tmp;            // cast after using __int128
+            tree[idx].mn = min(L.mn, R.mn);
+            tree[idx].mx = max(L.mx, R.mx);
+        }
+
+        // l, r are leaf positions of the half-open range [l, r)
+        void pushBounds(int l, int r){
+            for (int i = lg; i >= 1; --i){
+                if (((l >> i) << i) != l) push(l >> i);
+                if (((r >> i) << i) != r) push((r - 1) >> i);
+            }
+        }
+
+        void pullBounds(int l, int r){
+            for (int i = 1; i <= lg; ++i){
+                if (((l >> i) << i) != l) pull(l >> i);
+                if (((r >> i) << i) != r) pull((r - 1) >> i);
+            }
+        }
+
+        // clamp [L, R] to [0, n-1] like the recursive tree; false if nothing is left
+        inline bool clampRange(int& L, int& R) const {
+            L = max(L, 0); R = min(R, n - 1);
+            return L <= R;
+        }
+
+        template <typename Apply>
+        void rangeApply(int L, int R, Apply apply){
+            if (!clampRange(L, R)) return;
+            int l = L + size, r = R + 1 + size;
+            pushBounds(l, r);
+            for (int a = l, b = r; a < b; a >>= 1, b >>= 1){
+                if (a & 1) apply(a++);
+                if (b & 1) apply(--b);
+            }
+            pullBounds(l, r);
+        }
+
+        static Summary merge(const Summary& a, const Summary& b) {
+            __int128 tmp = (__int128)a.sum + (__int128)b.sum;
+            return Summary((T)tmp, min(a.mn, b.mn), max(a.mx, b.mx), a.len + b.len);
+        }
+
+        Summary nodeSummary(int idx) const {
+            return Summary(tree[idx].sum, tree[idx].mn, tree[idx].mx, tree[idx].sz);
+        }
+
+        void build(const vector<T>& arr = {}){
+            size = 1; lg = 0;
+            while (size < n) { size <<= 1; ++lg; }
+            tree.assign(2 * size, Node());
+            for (int i = 0; i < n; ++i){
+                Node &leaf = tree[size + i];
+                T val = arr.empty() ? 0 : arr[i];
+                leaf.sum = leaf.mn = leaf.mx = val;
+                leaf.sz = 1;
+            }
+            for (int i = size - 1; i >= 1; --i) pull(i);
+        }
+
+    public:
+        // --- Constructors ---
+        SegTree1DIter(int n_ = 0): n(n_) {
+            if (n > 0) build();
+        }
+        SegTree1DIter(const vector<T>& arr){ init(arr); }
+
+        void init(const vector<T>& arr){
+            n = (int)arr.size();
+            build(arr);
+        }
+
+        // --- Public API (identical to SegTree1D) ---
+        void rangeAssign(int L, int R, T val){
+            ensure_not_empty();
+            rangeApply(L, R, [&](int idx){ applyAssign(idx, val); });
+        }
+        void rangeAdd(int L, int R, T val){
+            ensure_not_empty();
+            rangeApply(L, R, [&](int idx){ applyAdd(idx, val); });
+        }
+        void pointAssign(int pos, T val){ rangeAssign(pos, pos, val); }
+        void pointAdd(int pos, T val){ rangeAdd(pos, pos, val); }
+
+        T rangeSum(int L, int R){
+            ensure_not_empty();
+            if (!clampRange(L, R)) return T(0);
+            int l = L + size, r = R + 1 + size;
+            pushBounds(l, r);
+            __int128 res = 0;
+            for (; l < r; l >>= 1, r >>= 1){
+                if (l & 1) res += tree[l++].sum;
+                if (r & 1) res += tree[--r].sum;
+            }
+            return (T)res;
+        }
+
+        T rangeMin(int L, int R){
+            ensure_not_empty();
+            T res = numeric_limits<T>::max();
+            if (!clampRange(L, R)) return res;
+            int l = L + size, r = R + 1 + size;
+            pushBounds(l, r);
+            for (; l < r; l >>= 1, r >>= 1){
+                if (l & 1) res = min(res, tree[l++].mn);
+                if (r & 1) res = min(res, tree[--r].mn);
+            }
+            return res;
+        }
+
+        T rangeMax(int L, int R){
+            ensure_not_empty();
+            T res = numeric_limits<T>::lowest();
+            if (!clampRange(L, R)) return res;
+            int l = L + size, r = R + 1 + size;
+            pushBounds(l, r);
+            for (; l < r; l >>= 1, r >>= 1){
+                if (l & 1) res = max(res, tree[l++].mx);
+                if (r & 1) res = max(res, tree[--r].mx);
+            }
+            return res;
+        }
+
+        T pointQuery(int pos){
+            ensure_not_empty();
+            int leaf = min(max(pos, 0), n - 1) + size;
+            for (int i = lg; i >= 1; --i) push(leaf >> i);
+            return tree[leaf].sum;
+        }
+
+        // --- Tree descent ---
+        template <typename Pred>
+        int maxRight(int L, Pred pred){
+            ensure_not_empty();
+            if (L >= n) return n - 1;
+            int l = max(L, 0) + size;
+            for (int i = lg; i >= 1; --i) push(l >> i);
+            Summary acc;
+            do {
+                while ((l & 1) == 0) l >>= 1;
+                if (!pred(merge(acc, nodeSummary(l)))) {
+                    while (l < size) {
+                        push(l);
+                        l <<= 1;
+                        Summary nxt = merge(acc, nodeSummary(l));
+                        if (pred(nxt)) { acc = nxt; ++l; }
+                    }
+                    return l - size - 1;
+                }
+                acc = merge(acc, nodeSummary(l));
+                ++l;
+            } while ((l & -l) != l);
+            return n - 1;
+        }
+
+        template <typename Pred>
+        int minLeft(int R, Pred pred){
+            ensure_not_empty();
+            if (R < 0) return 0;
+            int r = min(R, n - 1) + 1 + size;
+            for (int i = lg; i >= 1; --i) push((r - 1) >> i);
+            Summary acc;
+            do {
+                --r;
+                while (r > 1 && (r & 1)) r >>= 1;
+                if (!pred(merge(nodeSummary(r), acc))) {
+                    while (r < size) {
+                        push(r);
+                        r = r << 1 | 1;
+                        Summary nxt = merge(nodeSummary(r), acc);
+                        if (pred(nxt)) { acc = nxt; --r; }
+                    }
+                    return r + 1 - size;
+                }
+                acc = merge(nodeSummary(r), acc);
+            } while ((r & -r) != r);
+            return 0;
+        }
+
+        int findFirstBelow(int L, T x){
+            int r = maxRight(L, [&](const Summary& s){ return s.mn >= x; });
+            return r + 1 < n ? r + 1 : -1;
+        }
+
+        int findKthPrefix(T k){
+            int r = maxRight(0, [&](const Summary& s){ return s.sum < k; });
+            return r + 1 < n ? r + 1 : -1;
+        }
+    };
+}
@@ -0,0 +1,235 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        PersistentSegTree Class — Function Complexities
+        ===============================
+
+        Path-copying segment tree: every update copies the O(log n) nodes on its root
+        path and returns a new version id; all older versions stay queryable.
+        Nodes live in one contiguous arena (vector<Node>) with int child indices —
+        no `new`, no pointers — so memory is predictable and reset() frees all
+        versions at once while keeping the capacity for the next test case.
+
+        Node 0 is a shared all-zero node (its children are itself), so an all-zero
+        version costs O(1) nodes.
+
+        1. PersistentSegTree(n, reserveNodes)      → Constructor, version 0 = all zeros | Time: O(1) | Space: O(reserveNodes)
+        2. PersistentSegTree(arr, reserveNodes)    → Constructor, version 0 = arr       | Time: O(n) | Space: O(n)
+        3. init(arr) / reset()                     → Rebuild from arr / drop all versions | Time: O(n) / O(1)
+        4. reserve(nodes)                          → Pre-size the arena                 | Time: O(nodes)
+
+        5. pointAdd(ver, pos, delta)               → New version with a[pos] += delta   | Time: O(log n) | Space: O(log n)
+        6. pointAssign(ver, pos, val)              → New version with a[pos] = val      | Time: O(log n) | Space: O(log n)
+
+        7. rangeSum(ver, L, R)                     → Sum over [L, R] in version ver     | Time: O(log n) | Space: O(1)
+        8. pointQuery(ver, pos)                    → a[pos] in version ver              | Time: O(log n) | Space: O(1)
+        9. rangeSumDiff(verA, verB, L, R)          → rangeSum(verB) - rangeSum(verA)    | Time: O(log n) | Space: O(1)
+        10. kthIndex(verA, verB, k)                → Smallest pos with prefix of (verB - verA) >= k, -1 if none | Time: O(log n)
+
+        11. versions() / nodeCount() / root(ver)   → Bookkeeping                        | Time: O(1)
+
+        RangeOrderStats<T> (built on PersistentSegTree<int> over compressed values):
+        12. RangeOrderStats(arr)                   → n versions, one per prefix         | Time: O(n log n) | Space: O(n log n)
+        13. kthSmallest(L, R, k)                   → k-th smallest (1-based k) in arr[L..R] | Time: O(log n)
+        14. countLessEqual(L, R, x)                → #{i in [L, R] : arr[i] <= x}       | Time: O(log n)
+        15. countInRange(L, R, lo, hi)             → #{i in [L, R] : lo <= arr[i] <= hi}| Time: O(log n)
+
+        Where:
+            n        = number of positions
+            ver      = version id returned by an update (0 = initial version)
+            L,R,pos  = 0-based inclusive indices
+            nodes    = arena size; a sequence of u updates needs about n + u * (log2 n + 1) nodes
+    */
+
+
+    template <typename T>
+    class PersistentSegTree {
+    private:
+        struct Node {
+            int lc, rc;
+            T sum;
+        };
+
+        int n = 0;
+        vector<Node> pool;   // arena, pool[0] = shared zero node
+        vector<int> roots;   // roots[ver] = root node of version ver
+
+        inline int newNode(int lc, int rc, T sum) {
+            pool.push_back(Node{lc, rc, sum});
+            return (int)pool.size() - 1;
+        }
+
+        int build(int l, int r, const vector<T>& arr) {
+            if (l == r) return newNode(0, 0, arr[l]);
+            int mid = (l + r) >> 1;
+            int lc = build(l, mid, arr);
+            int rc = build(mid + 1, r, arr);
+            return newNode(lc, rc, pool[lc].sum + pool[rc].sum);
+        }
+
+        // assign = true: a[pos] = val, otherwise a[pos] += val
+        int update(int node, int l, int r, int pos, T val, bool assign) {
+            if (l == r) return newNode(0, 0, assign ? val : pool[node].sum + val);
+            int mid = (l + r) >> 1;
+            int lc = pool[node].lc, rc = pool[node].rc;
+            if (pos <= mid) lc = update(lc, l, mid, pos, val, assign);
+            else rc = update(rc, mid + 1, r, pos, val, assign);
+            return newNode(lc, rc, pool[lc].sum + pool[rc].sum);
+        }
+
+        T rangeSum(int node, int l, int r, int L, int R) const {
+            if (node == 0 || R < l || r < L) return T(0);
+            if (L <= l && r <= R) return pool[node].sum;
+            int mid = (l + r) >> 1;
+            return rangeSum(pool[node].lc, l, mid, L, R) + rangeSum(pool[node].rc, mid + 1, r, L, R);
+        }
+
+        void ensure_version(int ver) const {
+            if (ver < 0 || ver >= (int)roots.size()) throw out_of_range("PersistentSegTree: invalid version");
+        }
+
+        void ensure_not_empty() const {
+            if (n == 0) throw runtime_error("PersistentSegTree: operation on empty tree");
+        }
+
+        void ensure_pos(int pos) const {
+            if (pos < 0 || pos >= n) throw out_of_range("PersistentSegTree: invalid position");
+        }
+
+    public:
+        explicit PersistentSegTree(int n_ = 0, size_t reserveNodes = 0) : n(n_) {
+            reserve(reserveNodes);
+            reset();
+        }
+
+        explicit PersistentSegTree(const vector<T>& arr, size_t reserveNodes = 0) {
+            reserve(max(reserveNodes, 2 * arr.size() + 1));
+            init(arr);
+        }
+
+        // Rebuild version 0 from arr, dropping every other version
+        void init(const vector<T>& arr) {
+            n = (int)arr.size();
+            reset();
+            if (n > 0) roots[0] = build(0, n - 1, arr);
+        }
+
+        // Drop every version (arena capacity is kept); version 0 = all zeros
+        void reset() {
+            pool.clear();
+            pool.push_back(Node{0, 0, T(0)});
+            roots.assign(1, 0);
+        }
+
+        void reserve(size_t nodes) { pool.reserve(nodes); roots.reserve(nodes / 16 + 1); }
+
+        // --- Updates: each returns the id of the new version ---
+        int pointAdd(int ver, int pos, T delta) {
+            ensure_version(ver);
+            ensure_not_empty();
+            ensure_pos(pos);
+            roots.push_back(update(roots[ver], 0, n - 1, pos, delta, false));
+            return (int)roots.size() - 1;
+        }
+
+        int pointAssign(int ver, int pos, T val) {
+            ensure_version(ver);
+            ensure_not_empty();
+            ensure_pos(pos);
+            roots.push_back(update(roots[ver], 0, n - 1, pos, val, true));
+            return (int)roots.size() - 1;
+        }
+
+        // --- Queries ---
+        T rangeSum(int ver, int L, int R) const {
+            ensure_version(ver);
+            if (L > R) return T(0);
+            return rangeSum(roots[ver], 0, n - 1, L, R);
+        }
+
+        T pointQuery(int ver, int pos) const { return rangeSum(ver, pos, pos); }
+
+        T rangeSumDiff(int verA, int verB, int L, int R) const {
+            return rangeSum(verB, L, R) - rangeSum(verA, L, R);
+        }
+
+        // Smallest pos such that sum of (verB - verA) over [0, pos] >= k (values assumed non-negative)
+        int kthIndex(int verA, int verB, T k) const {
+            ensure_version(verA); ensure_version(verB);
+            int a = roots[verA], b = roots[verB];
+            if (n == 0 || pool[b].sum - pool[a].sum < k) return -1;
+            int l = 0, r = n - 1;
+            while (l < r) {
+                int mid = (l + r) >> 1;
+                T leftCnt = pool[pool[b].lc].sum - pool[pool[a].lc].sum;
+                if (leftCnt >= k) {
+                    a = pool[a].lc; b = pool[b].lc; r = mid;
+                } else {
+                    k -= leftCnt;
+                    a = pool[a].rc; b = pool[b].rc; l = mid + 1;
+                }
+            }
+            return l;
+        }
+
+        int versions() const { return (int)roots.size(); }
+        size_t nodeCount() const { return pool.size(); }
+        int root(int ver) const { ensure_version(ver); return roots[ver]; }
+        int size() const { return n; }
+    };
+
+
+    template <typename T>
+    class RangeOrderStats {
+    private:
+        vector<T> vals;                 // sorted unique values
+        PersistentSegTree<int> pst;     // version i = counts of arr[0..i-1]
+
+        // number of distinct values <= x
+        int rankUpper(const T& x) const { return int(upper_bound(vals.begin(), vals.end(), x) - vals.begin()); }
+
+    public:
+        explicit RangeOrderStats(const vector<T>& arr) {
+            vals = arr;
+            sort(vals.begin(), vals.end());
+            vals.erase(unique(vals.begin(), vals.end()), vals.end());
+            int m = max(1, (int)vals.size());
+            int depth = 1;
+            while ((1 << (depth - 1)) < m) ++depth;
+            pst = PersistentSegTree<int>(m, 1 + arr.size() * (depth + 1));
+            for (int i = 0; i < (int)arr.size(); ++i) {
+                int c = int(lower_bound(vals.begin(), vals.end(), arr[i]) - vals.begin());
+                pst.pointAdd(i, c, 1);
+            }
+        }
+
+        // k-th smallest (1-based) in arr[L..R]
+        T kthSmallest(int L, int R, int k) const {
+            if (L > R || k < 1 || k > R - L + 1) throw out_of_range("RangeOrderStats::kthSmallest - invalid k");
+            return vals[pst.kthIndex(L, R + 1, k)];
+        }
+
+        int countLessEqual(int L, int R, const T& x) const {
+            int hi = rankUpper(x) - 1;
+            if (L > R || hi < 0) return 0;
+            return pst.rangeSumDiff(L, R + 1, 0, hi);
+        }
+
+        int countInRange(int L, int R, const T& lo, const T& hi) const {
+            if (hi < lo) return 0;
+            int a = int(lower_bound(vals.begin(), vals.end(), lo) - vals.begin());
+            int b = rankUpper(hi) - 1;
+            if (L > R || a > b) return 0;
+            return pst.rangeSumDiff(L, R + 1, a, b);
+        }
+    };
+}
@@ -0,0 +1,269 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        SegTreeLazy<Policy> Class — Function Complexities
+        ===============================
+
+        Iterative lazy segment tree where the monoid (S, op, e) and the lazy action
+        (F, mapping, composition, id) are supplied at compile time by a Policy type.
+        Every node stores exactly one S and every internal node one F — nothing more —
+        so a sum-only workload keeps 2 words per node instead of SegTree1D's 7 fields.
+
+        1. SegTreeLazy(n)                          → Constructor (all e())       | Time: O(n) | Space: O(n)
+        2. SegTreeLazy(arr)                        → Constructor (from vector<S>)| Time: O(n) | Space: O(n)
+        3. init(arr)                               → Initialize/rebuild tree     | Time: O(n) | Space: O(n)
+
+        4. rangeApply(L, R, f)                     → Apply action f to [L, R]    | Time: O(log n) | Space: O(1)
+        5. pointApply(pos, f)                      → Apply action f to pos       | Time: O(log n) | Space: O(1)
+        6. pointSet(pos, x)                        → Overwrite element pos by x  | Time: O(log n) | Space: O(1)
+
+        7. rangeQuery(L, R)                        → op over [L, R]              | Time: O(log n) | Space: O(1)
+        8. pointQuery(pos)                         → Element at pos              | Time: O(log n) | Space: O(1)
+        9. allQuery()                              → op over whole array         | Time: O(1)     | Space: O(1)
+        10. size()                                 → Number of elements          | Time: O(1)     | Space: O(1)
+
+        Policy requirements (all static):
+            using S, F;
+            S e();                                 → identity of op
+            S op(const S& a, const S& b);          → associative combine
+            F id();                                → identity action
+            S mapping(const F& f, const S& x, int len); → apply f to a node covering len elements
+            F composition(const F& f, const F& g); → f applied after g
+
+        Ready-made policies:
+            SumAddPolicy<T>              → range add, range sum
+            MinAddPolicy<T>              → range add, range min
+            MaxAddPolicy<T>              → range add, range max
+            SumAssignPolicy<T>           → range assign, range sum
+            AffineSumPolicy<T>           → range x = b*x + c, range sum
+            SumMinMaxAddAssignPolicy<T>  → SegTree1D's full sum/min/max + add/assign combination
+
+        Where:
+            n   = number of elements
+            L,R = 0-based inclusive range boundaries, clamped to [0, n-1] as in SegTree1D
+            pos = 0-based index, out_of_range if outside [0, n)
+            f   = lazy action (Policy::F)
+
+        Usage Example:
+            SegTreeLazy<SumAddPolicy<long long>> st(vector<long long>{1, 2, 3});
+            st.rangeApply(0, 1, 5);          // [6, 7, 3]
+            long long s = st.rangeQuery(0, 2); // 16
+    */
+
+
+#ifndef LAZY_POLICIES_DEFINED
+#define LAZY_POLICIES_DEFINED
+
+    template <typename T>
+    struct SumAddPolicy {
+        using S = T;
+        using F = T;
+        static S e() { return T(0); }
+        static S op(const S& a, const S& b) { return a + b; }
+        static F id() { return T(0); }
+        static S mapping(const F& f, const S& x, int len) { return x + f * len; }
+        static F composition(const F& f, const F& g) { return f + g; }
+    };
+
+    template <typename T>
+    struct MinAddPolicy {
+        using S = T;
+        using F = T;
+        static S e() { return numeric_limits<T>::max(); }
+        static S op(const S& a, const S& b) { return min(a, b); }
+        static F id() { return T(0); }
+        static S mapping(const F& f, const S& x, int) { return x == e() ? x : x + f; }
+        static F composition(const F& f, const F& g) { return f + g; }
+    };
+
+    template <typename T>
+    struct MaxAddPolicy {
+        using S = T;
+        using F = T;
+        static S e() { return numeric_limits<T>::lowest(); }
+        static S op(const S& a, const S& b) { return max(a, b); }
+        static F id() { return T(0); }
+        static S mapping(const F& f, const S& x, int) { return x == e() ? x : x + f; }
+        static F composition(const F& f, const F& g) { return f + g; }
+    };
+
+    template <typename T>
+    struct SumAssignPolicy {
+        struct F { T val; bool has; };
+        using S = T;
+        static S e() { return T(0); }
+        static S op(const S& a, const S& b) { return a + b; }
+        static F id() { return F{T(0), false}; }
+        static S mapping(const F& f, const S& x, int len) { return f.has ? f.val * len : x; }
+        static F composition(const F& f, const F& g) { return f.has ? f : g; }
+    };
+
+    template <typename T>
+    struct AffineSumPolicy {
+        struct F { T b, c; };  // x -> b*x + c
+        using S = T;
+        static S e() { return T(0); }
+        static S op(const S& a, const S& b) { return a + b; }
+        static F id() { return F{T(1), T(0)}; }
+        static S mapping(const F& f, const S& x, int len) { return f.b * x + f.c * len; }
+        static F composition(const F& f, const F& g) { return F{f.b * g.b, f.b * g.c + f.c}; }
+    };
+
+    template <typename T>
+    struct SumMinMaxAddAssignPolicy {
+        struct S {
+            T sum, mn, mx;
+            S(): sum(0), mn(numeric_limits<T>::max()), mx(numeric_limits<T>::lowest()) {}
+            S(T v): sum(v), mn(v), mx(v) {}
+            S(T s, T a, T b): sum(s), mn(a), mx(b) {}
+        };
+        struct F { T add, assignVal; bool hasAssign; };
+        static S e() { return S(); }
+        static S op(const S& a, const S& b) {
+            __int128 tmp = (__int128)a.sum + (__int128)b.sum;
+            return S((T)tmp, min(a.mn, b.mn), max(a.mx, b.mx));
+        }
+        static F id() { return F{T(0), T(0), false}; }
+        static S mapping(const F& f, const S& x, int len) {
+            if (f.hasAssign) {
+                T v = f.assignVal + f.add;
+                return S((T)((__int128)v * len), v, v);
+            }
+            if (f.add == T(0)) return x;
+            S res = x;
+            res.sum = (T)((__int128)x.sum + (__int128)f.add * len);
+            if (res.mn != numeric_limits<T>::max()) res.mn += f.add;
+            if (res.mx != numeric_limits<T>::lowest()) res.mx += f.add;
+            return res;
+        }
+        static F composition(const F& f, const F& g) {
+            if (f.hasAssign) return f;
+            return F{g.add + f.add, g.assignVal, g.hasAssign};
+        }
+    };
+
+#endif
+
+
+    template <typename Policy>
+    class SegTreeLazy {
+    public:
+        using S = typename Policy::S;
+        using F = typename Policy::F;
+
+    private:
+        int n = 0;
+        int sz = 1;         // number of leaves (power of two >= n)
+        int lg = 0;         // log2(sz)
+        vector<S> d;        // aggregates, d[1] = root, leaves at [sz, 2*sz)
+        vector<F> lz;       // lazy actions, internal nodes only
+
+        // number of elements covered by node idx
+        inline int len(int idx) const { return sz >> (31 - __builtin_clz(idx)); }
+
+        inline void pull(int idx) { d[idx] = Policy::op(d[idx<<1], d[idx<<1|1]); }
+
+        inline void applyAt(int idx, const F& f) {
+            d[idx] = Policy::mapping(f, d[idx], len(idx));
+            if (idx < sz) lz[idx] = Policy::composition(f, lz[idx]);
+        }
+
+        inline void push(int idx) {
+            applyAt(idx<<1, lz[idx]);
+            applyAt(idx<<1|1, lz[idx]);
+            lz[idx] = Policy::id();
+        }
+
+        // l, r are leaf positions of the half-open range [l, r)
+        void pushBounds(int l, int r) {
+            for (int i = lg; i >= 1; --i) {
+                if (((l >> i) << i) != l) push(l >> i);
+                if (((r >> i) << i) != r) push((r - 1) >> i);
+            }
+        }
+
+        void pullBounds(int l, int r) {
+            for (int i = 1; i <= lg; ++i) {
+                if (((l >> i) << i) != l) pull(l >> i);
+                if (((r >> i) << i) != r) pull((r - 1) >> i);
+            }
+        }
+
+        // clamp [L, R] to [0, n-1] like SegTree1D; false if nothing is left
+        inline bool clampRange(int& L, int& R) const {
+            L = max(L, 0); R = min(R, n - 1);
+            return L <= R;
+        }
+
+        inline void checkPos(int pos) const {
+            if (pos < 0 || pos >= n) throw out_of_range("SegTreeLazy: invalid position");
+        }
+
+    public:
+        SegTreeLazy(int n_ = 0) { init(vector<S>(max(0, n_), Policy::e())); }
+        SegTreeLazy(const vector<S>& arr) { init(arr); }
+
+        void init(const vector<S>& arr) {
+            n = (int)arr.size();
+            sz = 1; lg = 0;
+            while (sz < n) { sz <<= 1; ++lg; }
+            d.assign(2 * sz, Policy::e());
+            lz.assign(sz, Policy::id());
+            for (int i = 0; i < n; ++i) d[sz + i] = arr[i];
+            for (int i = sz - 1; i >= 1; --i) pull(i);
+        }
+
+        void rangeApply(int L, int R, const F& f) {
+            if (!clampRange(L, R)) return;
+            int l = L + sz, r = R + 1 + sz;
+            pushBounds(l, r);
+            for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+                if (a & 1) applyAt(a++, f);
+                if (b & 1) applyAt(--b, f);
+            }
+            pullBounds(l, r);
+        }
+
+        void pointApply(int pos, const F& f) { checkPos(pos); rangeApply(pos, pos, f); }
+
+        void pointSet(int pos, const S& x) {
+            checkPos(pos);
+            int leaf = pos + sz;
+            for (int i = lg; i >= 1; --i) push(leaf >> i);
+            d[leaf] = x;
+            for (int i = 1; i <= lg; ++i) pull(leaf >> i);
+        }
+
+        S rangeQuery(int L, int R) {
+            if (!clampRange(L, R)) return Policy::e();
+            int l = L + sz, r = R + 1 + sz;
+            pushBounds(l, r);
+            S resL = Policy::e(), resR = Policy::e();
+            for (; l < r; l >>= 1, r >>= 1) {
+                if (l & 1) resL = Policy::op(resL, d[l++]);
+                if (r & 1) resR = Policy::op(d[--r], resR);
+            }
+            return Policy::op(resL, resR);
+        }
+
+        S pointQuery(int pos) {
+            checkPos(pos);
+            int leaf = pos + sz;
+            for (int i = lg; i >= 1; --i) push(leaf >> i);
+            return d[leaf];
+        }
+
+        S allQuery() const { return d[1]; }
+
+        int size() const { return n; }
+    };
+}
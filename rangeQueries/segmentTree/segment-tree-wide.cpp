@@ -0,0 +1,198 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        WideSegTree<T, Op, B> Class — Function Complexities
+        ===============================
+
+        Static B-ary ("S-tree" style) segment tree for read-heavy sum/min workloads.
+        Level 0 is the array itself, level k+1 holds one aggregate per B-block of level k,
+        and all levels sit in one 64-byte-aligned buffer. A node is B consecutive values
+        (one cache line for B = 64 / sizeof(T)), so a query touches two nodes per level
+        and there are only log_B(n) levels instead of log_2(n).
+
+        Inside a node, partial ranges are reduced with a branchless masked loop over all
+        B lanes (compare lane index against [lo, hi], select value or identity), which GCC
+        turns into SIMD compares + blends at -O3 (add -march=native for AVX2/AVX-512).
+
+        1. WideSegTree(arr)                        → Build from array             | Time: O(n)            | Space: O(n · B/(B-1))
+        2. pointSet(pos, val)                      → a[pos] = val                 | Time: O(B · log_B n)  | Space: O(1)
+        3. pointAdd(pos, delta)                    → a[pos] = op(a[pos], delta)   | Time: O(B · log_B n)  | Space: O(1)
+        4. query(L, R)                             → op over [L, R]               | Time: O(B · log_B n), 2 nodes per level | Space: O(1)
+        5. pointQuery(pos)                         → a[pos]                       | Time: O(1)
+        6. lowerBound(k)                           → First index with prefix sum >= k, n if none (WideSum, values >= 0)
+                                                    | Time: O(B · log_B n), child picked by counting lanes with prefix < k
+        7. size()                                  → Number of elements           | Time: O(1)
+
+        Ready-made ops: WideSum<T>, WideMin<T>, WideMax<T>
+            (an Op provides static T identity() and static T combine(T, T); it must be commutative)
+
+        Where:
+            n   = number of elements
+            B   = branching factor (default 64 / sizeof(T): 16 for int, 8 for long long)
+            L,R = 0-based inclusive indices, invalid ranges throw out_of_range
+            pos = 0-based index, out_of_range if outside [0, n)
+
+        Usage Example:
+            WideSegTree<int, WideMin<int>> wmin(arr);
+            int m = wmin.query(l, r);
+    */
+
+
+    template <typename T>
+    struct WideSum {
+        static T identity() { return T(0); }
+        static T combine(T a, T b) { return a + b; }
+    };
+
+    template <typename T>
+    struct WideMin {
+        static T identity() { return numeric_limits<T>::max(); }
+        static T combine(T a, T b) { return a < b ? a : b; }
+    };
+
+    template <typename T>
+    struct WideMax {
+        static T identity() { return numeric_limits<T>::lowest(); }
+        static T combine(T a, T b) { return a > b ? a : b; }
+    };
+
+
+    template <typename T, typename Op = WideSum<T>, int B = max<int>(8, 64 / (int)sizeof(T))>
+    class WideSegTree {
+    private:
+        static_assert((B & (B - 1)) == 0, "WideSegTree: B must be a power of two");
+        static constexpr size_t ALIGN = 64;
+
+        struct AlignedDeleter {
+            void operator()(T* p) const { ::operator delete[](p, align_val_t(ALIGN)); }
+        };
+
+        int n = 0;
+        vector<size_t> offset;             // offset[k] = start of level k in buf
+        vector<int> len;                   // len[k] = padded length of level k (multiple of B)
+        unique_ptr<T[], AlignedDeleter> buf;
+
+        // op over lanes lo..hi of one node, every lane evaluated (vectorizable)
+        static inline T reduceMasked(const T* __restrict p, int lo, int hi) {
+            T acc = Op::identity();
+            for (int i = 0; i < B; ++i) {
+                T v = (i >= lo && i <= hi) ? p[i] : Op::identity();
+                acc = Op::combine(acc, v);
+            }
+            return acc;
+        }
+
+        static inline T reduceFull(const T* __restrict p) {
+            T acc = Op::identity();
+            for (int i = 0; i < B; ++i) acc = Op::combine(acc, p[i]);
+            return acc;
+        }
+
+        inline T* level(int k) const { return buf.get() + offset[k]; }
+
+        inline void checkPos(int pos) const {
+            if (pos < 0 || pos >= n) throw out_of_range("WideSegTree: invalid position");
+        }
+
+        // Recompute aggregates above level-0 position pos
+        void refresh(int pos) {
+            for (int k = 0; k + 1 < (int)len.size(); ++k) {
+                int node = pos / B;
+                level(k + 1)[node] = reduceFull(level(k) + (size_t)node * B);
+                pos = node;
+            }
+        }
+
+    public:
+        WideSegTree() = default;
+
+        explicit WideSegTree(const vector<T>& arr) : n((int)arr.size()) {
+            // level sizes: each padded to a multiple of B, until a level fits in one node
+            size_t total = 0;
+            int cnt = max(1, n);
+            while (true) {
+                int padded = (cnt + B - 1) / B * B;
+                offset.push_back(total);
+                len.push_back(padded);
+                total += padded;
+                if (padded == B) break;
+                cnt = padded / B;
+            }
+            buf.reset(static_cast<T*>(::operator new[](total * sizeof(T), align_val_t(ALIGN))));
+            for (size_t i = 0; i < total; ++i) buf[i] = Op::identity();
+
+            copy(arr.begin(), arr.end(), level(0));
+            for (int k = 0; k + 1 < (int)len.size(); ++k) {
+                const T* src = level(k);
+                T* dst = level(k + 1);
+                int nodes = len[k] / B;
+                for (int j = 0; j < nodes; ++j) dst[j] = reduceFull(src + (size_t)j * B);
+            }
+        }
+
+        void pointSet(int pos, T val) {
+            checkPos(pos);
+            level(0)[pos] = val;
+            refresh(pos);
+        }
+
+        void pointAdd(int pos, T delta) {
+            checkPos(pos);
+            level(0)[pos] = Op::combine(level(0)[pos], delta);
+            refresh(pos);
+        }
+
+        T pointQuery(int pos) const { checkPos(pos); return level(0)[pos]; }
+
+        T query(int L, int R) const {
+            if (n == 0) throw out_of_range("WideSegTree: empty tree");
+            if (L < 0 || R >= n || L > R) throw out_of_range("WideSegTree::query - invalid range");
+            T res = Op::identity();
+            for (int k = 0; k < (int)len.size() && L <= R; ++k) {
+                const T* a = level(k);
+                int bl = L / B, br = R / B;
+                if (bl == br) {
+                    res = Op::combine(res, reduceMasked(a + (size_t)bl * B, L - bl * B, R - bl * B));
+                    break;
+                }
+                res = Op::combine(res, reduceMasked(a + (size_t)bl * B, L - bl * B, B - 1));
+                res = Op::combine(res, reduceMasked(a + (size_t)br * B, 0, R - br * B));
+                L = bl + 1;
+                R = br - 1;
+            }
+            return res;
+        }
+
+        // First index whose prefix sum is >= k (n if the total is < k); needs WideSum and values >= 0
+        int lowerBound(T k) const {
+            static_assert(is_same<Op, WideSum<T>>::value, "WideSegTree::lowerBound requires WideSum");
+            if (k <= T(0)) return 0;
+            int node = 0;
+            for (int lv = (int)len.size() - 1; lv >= 0; --lv) {
+                const T* p = level(lv) + (size_t)node * B;
+                // lanes whose running prefix stays below k: branch-free count picks the child
+                T pre = T(0);
+                int below = 0;
+                for (int i = 0; i < B; ++i) {
+                    pre += p[i];
+                    below += (pre < k);
+                }
+                if (below == B) return n;               // total of this node < remaining k
+                for (int i = 0; i < below; ++i) k -= p[i];
+                node = node * B + below;
+            }
+            return min(node, n);
+        }
+
+        int size() const { return n; }
+    };
+}
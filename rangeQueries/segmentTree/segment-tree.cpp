@@ -27,12 +27,24 @@ inline namespace MY{
         10. rangeMax(L, R)                         → Query maximum over [L, R]  | Time: O(log n) | Space: O(1)
         11. pointQuery(pos)                        → Query exact element value  | Time: O(log n) | Space: O(log n) (due to push path)
 
+        --- Tree Descent (predicate must be monotone, pred(empty) = true) ---
+        12. maxRight(L, pred)                      → Largest R with pred(summary[L..R]) true, L-1 if none | Time: O(log n) | Space: O(log n)
+        13. minLeft(R, pred)                       → Smallest L with pred(summary[L..R]) true, R+1 if none | Time: O(log n) | Space: O(log n)
+        14. findFirstBelow(L, x)                   → First index >= L with value < x, -1 if none        | Time: O(log n) | Space: O(log n)
+        15. findKthPrefix(k)                       → First index whose prefix sum >= k, -1 if none      | Time: O(log n) | Space: O(log n)
+                                                     (prefix sums must be non-decreasing, i.e. values >= 0)
+
+        --- Multithreaded Bulk Operations (results identical to the sequential path) ---
+        16. initParallel(arr, threads)             → Build subtrees concurrently, then pull the top levels | Time: O(n / threads + threads) | Space: O(n)
+        17. applyUpdates(updates, threads)         → Apply a batch of Update{L, R, val, isAssign} in order  | Time: O(u · (log n + c) / threads) | Space: O(u)
+
         --- Internal Helpers (for completeness) ---
-        12. build(idx, l, r, arr)                  → Build segment tree         | Time: O(n) | Space: O(n)
-        13. pull(idx)                              → Merge child nodes          | Time: O(1) | Space: O(1)
-        14. push(idx)                              → Propagate lazy updates     | Time: O(1) | Space: O(1)
-        15. applyAssign(idx, val)                  → Apply assignment lazily    | Time: O(1) | Space: O(1)
-        16. applyAdd(idx, val)                     → Apply addition lazily      | Time: O(1) | Space: O(1)
+        18. build(idx, l, r, arr)                  → Build segment tree         | Time: O(n) | Space: O(n)
+        19. pull(idx)                              → Merge child nodes          | Time: O(1) | Space: O(1)
+        20. push(idx)                              → Propagate lazy updates     | Time: O(1) | Space: O(1)
+        21. applyAssign(idx, val)                  → Apply assignment lazily    | Time: O(1) | Space: O(1)
+        22. applyAdd(idx, val)                     → Apply addition lazily      | Time: O(1) | Space: O(1)
+        23. collectFrontier / pushTop / pullTop    → Split the tree into ~4·threads independent subtrees | Time: O(threads)
 
         --- Overall Complexity Summary ---
         Build Time: O(n)
@@ -44,11 +56,71 @@ inline namespace MY{
             L,R = query/update range boundaries (0-based indices)
             pos = index for point operations
             val = assigned or added value
+            pred = callable bool(const Summary&), Summary = {sum, mn, mx, len} of a contiguous range
+            threads = worker count (0 = hardware_concurrency)
+            u   = number of updates in the batch, c = number of frontier subtrees an update touches
+
+        Bulk updates: every update is cut at subtree boundaries and each piece is queued
+        on its subtree in batch order, so each position still sees its updates in the
+        original order and the final array equals the one from applying them one by one.
+
+        Usage Example (descent):
+            SegTree1D<long long> st(arr);
+            int r = st.maxRight(l, [&](const SegTree1D<long long>::Summary& s){ return s.sum <= K; });
+            // r = last index such that arr[l] + ... + arr[r] <= K
     */
 
 
+#ifndef PARALLEL_HELPERS_DEFINED
+#define PARALLEL_HELPERS_DEFINED
+    // Worker count for a `threads` argument: 0 means hardware_concurrency, never below 1
+    inline int resolveThreads(int threads) {
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        return max(1, threads);
+    }
+
+    // Depth of the subtree frontier split among workers, ~4 subtrees per worker for balance
+    inline int frontierDepth(int threads) {
+        int d = 0;
+        while ((1 << d) < 4 * threads) ++d;
+        return d;
+    }
+
+    // Runs job(i) for i in [0, tasks) on `threads` workers, contiguous blocks per worker
+    template <typename Job>
+    void runParallel(int tasks, int threads, Job job) {
+        threads = min(threads, tasks);
+        if (threads <= 1) { for (int i = 0; i < tasks; ++i) job(i); return; }
+        vector<thread> pool;
+        pool.reserve(threads);
+        for (int t = 0; t < threads; ++t) {
+            int from = (int)((long long)tasks * t / threads);
+            int to = (int)((long long)tasks * (t + 1) / threads);
+            pool.emplace_back([from, to, &job]() { for (int i = from; i < to; ++i) job(i); });
+        }
+        for (auto& th : pool) th.join();
+    }
+#endif
+
+
     template <typename T>
     class SegTree1D {
+    public:
+        // One entry of a bulk update batch (see applyUpdates)
+        struct Update {
+            int L, R;
+            T val;
+            bool isAssign;   // true: assign val, false: add val
+        };
+
+        // Aggregate of a contiguous range, passed to descent predicates
+        struct Summary {
+            T sum, mn, mx;
+            int len;
+            Summary(): sum(0), mn(numeric_limits<T>::max()), mx(numeric_limits<T>::lowest()), len(0) {}
+            Summary(T s, T a, T b, int l): sum(s), mn(a), mx(b), len(l) {}
+        };
+
     private:
         struct Node {
             T sum, mn, mx;
@@ -187,6 +259,75 @@ inline namespace MY{
             return max(rangeMax(idx<<1, l, mid, L, R), rangeMax(idx<<1|1, mid+1, r, L, R));
         }
 
+        // ---- Descent helpers ----
+        static Summary merge(const Summary& a, const Summary& b) {
+            __int128 tmp = (__int128)a.sum + (__int128)b.sum;
+            return Summary((T)tmp, min(a.mn, b.mn), max(a.mx, b.mx), a.len + b.len);
+        }
+
+        Summary nodeSummary(int idx) const {
+            return Summary(tree[idx].sum, tree[idx].mn, tree[idx].mx, tree[idx].sz);
+        }
+
+        // First position p >= L such that pred(acc + [L..p]) fails, -1 if none
+        template <typename Pred>
+        int maxRight(int idx, int l, int r, int L, Summary& acc, Pred& pred) {
+            if (r < L) return -1;
+            if (L <= l) {
+                Summary nxt = merge(acc, nodeSummary(idx));
+                if (pred(nxt)) { acc = nxt; return -1; }
+                if (l == r) return l;
+            }
+            push(idx);
+            int mid = (l + r) >> 1;
+            int res = maxRight(idx<<1, l, mid, L, acc, pred);
+            if (res != -1) return res;
+            return maxRight(idx<<1|1, mid+1, r, L, acc, pred);
+        }
+
+        // Last position p <= R such that pred([p..R] + acc) fails, -1 if none
+        template <typename Pred>
+        int minLeft(int idx, int l, int r, int R, Summary& acc, Pred& pred) {
+            if (R < l) return -1;
+            if (r <= R) {
+                Summary nxt = merge(nodeSummary(idx), acc);
+                if (pred(nxt)) { acc = nxt; return -1; }
+                if (l == r) return l;
+            }
+            push(idx);
+            int mid = (l + r) >> 1;
+            int res = minLeft(idx<<1|1, mid+1, r, R, acc, pred);
+            if (res != -1) return res;
+            return minLeft(idx<<1, l, mid, R, acc, pred);
+        }
+
+        // ---- Multithreading helpers ----
+        struct Frontier { int idx, l, r; };
+
+        void collectFrontier(int idx, int l, int r, int depth, int target, vector<Frontier>& out) const {
+            if (depth == target || l == r) { out.push_back({idx, l, r}); return; }
+            int mid = (l + r) >> 1;
+            collectFrontier(idx<<1, l, mid, depth+1, target, out);
+            collectFrontier(idx<<1|1, mid+1, r, depth+1, target, out);
+        }
+
+        // Push every tag above the frontier so that frontier subtrees are self-contained
+        void pushTop(int idx, int l, int r, int depth, int target) {
+            if (depth == target || l == r) return;
+            push(idx);
+            int mid = (l + r) >> 1;
+            pushTop(idx<<1, l, mid, depth+1, target);
+            pushTop(idx<<1|1, mid+1, r, depth+1, target);
+        }
+
+        void pullTop(int idx, int l, int r, int depth, int target) {
+            if (depth == target || l == r) return;
+            int mid = (l + r) >> 1;
+            pullTop(idx<<1, l, mid, depth+1, target);
+            pullTop(idx<<1|1, mid+1, r, depth+1, target);
+            pull(idx);
+        }
+
     public:
         // --- Constructors ---
         SegTree1D(int n_ = 0): n(n_) {
@@ -203,6 +344,49 @@ inline namespace MY{
             if (n > 0) build(1, 0, n-1, arr);
         }
 
+        // Same result as init(arr); independent subtrees are built on separate threads
+        void initParallel(const vector<T>& arr, int threads = 0){
+            threads = resolveThreads(threads);
+            n = (int)arr.size();
+            tree.assign(4 * max(1,n), Node());
+            if (n == 0) return;
+            int target = frontierDepth(threads);
+            vector<Frontier> fr;
+            collectFrontier(1, 0, n-1, 0, target, fr);
+            runParallel((int)fr.size(), threads, [&](int i) { build(fr[i].idx, fr[i].l, fr[i].r, arr); });
+            pullTop(1, 0, n-1, 0, target);
+        }
+
+        // Applies updates in batch order; pieces falling into different subtrees run concurrently
+        void applyUpdates(const vector<Update>& updates, int threads = 0){
+            ensure_not_empty();
+            threads = resolveThreads(threads);
+            int target = frontierDepth(threads);
+            vector<Frontier> fr;
+            collectFrontier(1, 0, n-1, 0, target, fr);
+            int k = (int)fr.size();
+
+            // Stable partition: bucket[c] keeps, in batch order, the pieces clipped to subtree c
+            vector<vector<Update>> bucket(k);
+            for (const Update& u : updates) {
+                int L = max(0, u.L), R = min(n-1, u.R);
+                if (L > R) continue;
+                int c = int(upper_bound(fr.begin(), fr.end(), L,
+                            [](int pos, const Frontier& f) { return pos < f.l; }) - fr.begin()) - 1;
+                for (; c < k && fr[c].l <= R; ++c)
+                    bucket[c].push_back({max(L, fr[c].l), min(R, fr[c].r), u.val, u.isAssign});
+            }
+
+            pushTop(1, 0, n-1, 0, target);
+            runParallel(k, threads, [&](int c) {
+                for (const Update& u : bucket[c]) {
+                    if (u.isAssign) rangeAssign(fr[c].idx, fr[c].l, fr[c].r, u.L, u.R, u.val);
+                    else rangeAdd(fr[c].idx, fr[c].l, fr[c].r, u.L, u.R, u.val);
+                }
+            });
+            pullTop(1, 0, n-1, 0, target);
+        }
+
         // --- Public API ---
         void rangeAssign(int L, int R, T val){ ensure_not_empty(); rangeAssign(1,0,n-1,L,R,val); }
         void rangeAdd(int L, int R, T val){ ensure_not_empty(); rangeAdd(1,0,n-1,L,R,val); }
@@ -226,5 +410,34 @@ inline namespace MY{
             for (int id : path) push(id);
             return tree[idx].sum;
         }
+
+        // --- Tree descent ---
+        template <typename Pred>
+        int maxRight(int L, Pred pred) {
+            ensure_not_empty();
+            if (L >= n) return n - 1;
+            Summary acc;
+            int res = maxRight(1, 0, n-1, L, acc, pred);
+            return res == -1 ? n - 1 : res - 1;
+        }
+
+        template <typename Pred>
+        int minLeft(int R, Pred pred) {
+            ensure_not_empty();
+            if (R < 0) return 0;
+            Summary acc;
+            int res = minLeft(1, 0, n-1, R, acc, pred);
+            return res == -1 ? 0 : res + 1;
+        }
+
+        int findFirstBelow(int L, T x) {
+            int r = maxRight(L, [&](const Summary& s){ return s.mn >= x; });
+            return r + 1 < n ? r + 1 : -1;
+        }
+
+        int findKthPrefix(T k) {
+            int r = maxRight(0, [&](const Summary& s){ return s.sum < k; });
+            return r + 1 < n ? r + 1 : -1;
+        }
     };
 }
@@ -0,0 +1,135 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        LinearRMQ<T, Compare> Class — Function Complexities
+        ===============================
+
+        O(n) build / O(1) query range-extremum with (almost) linear memory, for arrays
+        where the n log n words of a sparse table do not fit (e.g. n = 5·10^8).
+
+        The array is cut into blocks of 64. Inside a block, masks[i] is the monotonic
+        stack of positions (one bit each) after scanning the block up to i; the answer on
+        [l, r] within one block is then the lowest set bit of masks[r] at or after l.
+        Block extrema go into an ordinary sparse table over n / 64 blocks, so a query
+        is at most two in-block lookups plus one sparse-table lookup.
+
+        1. LinearRMQ(a, cmp)                  → Constructor (copies or moves a)   | Time: O(n)     | Space: see below
+        2. queryIndex(l, r)                   → Index of the extremum on [l, r]   | Time: O(1)     | Space: O(1)
+        3. query(l, r)                        → Value of the extremum on [l, r]   | Time: O(1)     | Space: O(1)
+        4. size()                             → Number of elements                | Time: O(1)     | Space: O(1)
+
+        Where:
+            n      = number of elements (< 2^31)
+            l, r   = 0-based inclusive indices, invalid ranges throw out_of_range
+            cmp    = strict weak order, cmp(x, y) = "x is better than y":
+                     less<T> → minimum (default), greater<T> → maximum
+            Ties resolve to the leftmost index.
+            Space  = n · (sizeof(T) + 8) bytes + O((n / 64) · log n) (value, index) pairs
+                     (array copy + one 64-bit mask per position + block table)
+
+        Usage Example:
+            LinearRMQ<int> mn(a);                               // argmin
+            LinearRMQ<long long, greater<long long>> mx(move(b)); // argmax, no extra copy of b
+            int pos = mn.queryIndex(l, r);
+    */
+
+
+#ifndef LINEAR_RMQ_DEFINED
+#define LINEAR_RMQ_DEFINED
+    template <typename T, typename Compare = less<T>>
+    class LinearRMQ {
+    private:
+        static constexpr int B = 64;
+
+        vector<T> a;
+        vector<uint64_t> masks;        // masks[i]: in-block stack after position i
+        struct Entry { T v; int i; };
+        vector<Entry> table;           // sparse table over block extrema, level k at k · nb
+        int n = 0, nb = 0;
+        Compare cmp;
+
+        // leftmost of two candidate indices on ties (requires x < y)
+        inline const Entry& better(const Entry& x, const Entry& y) const { return cmp(y.v, x.v) ? y : x; }
+
+        inline Entry at(int i) const { return {a[i], i}; }
+
+        inline int inBlock(int l, int r) const {
+            uint64_t m = masks[r] & (~0ULL << (l & (B - 1)));
+            return (l & ~(B - 1)) + __builtin_ctzll(m);
+        }
+
+        [[noreturn]] __attribute__((noinline, cold)) void invalidRange() const {
+            if (n == 0) throw out_of_range("LinearRMQ: empty");
+            throw out_of_range("LinearRMQ::query - invalid range");
+        }
+
+        void build() {
+            n = (int)a.size();
+            nb = (n + B - 1) / B;
+            masks.assign(n, 0);
+
+            for (int b = 0; b < nb; ++b) {
+                int base = b * B, end = min(n, base + B);
+                uint64_t st = 0;
+                for (int i = base; i < end; ++i) {
+                    // pop strictly worse tops so that equal values keep the leftmost index
+                    while (st) {
+                        int top = base + 63 - __builtin_clzll(st);
+                        if (!cmp(a[i], a[top])) break;
+                        st ^= 1ULL << (top - base);
+                    }
+                    st |= 1ULL << (i - base);
+                    masks[i] = st;
+                }
+            }
+
+            int levels = nb ? 32 - __builtin_clz((unsigned)nb) : 0;
+            table.resize((size_t)levels * nb);
+            for (int b = 0; b < nb; ++b) table[b] = at(b * B + __builtin_ctzll(masks[min(n, b * B + B) - 1]));
+            for (int k = 1; k < levels; ++k) {
+                const Entry* prev = table.data() + (size_t)(k - 1) * nb;
+                Entry* cur = table.data() + (size_t)k * nb;
+                int half = 1 << (k - 1);
+                for (int i = 0; i + (1 << k) <= nb; ++i) cur[i] = better(prev[i], prev[i + half]);
+            }
+        }
+
+        // block table entries carry their value, so a query touches a[] only at the two ends
+        Entry best(int l, int r) const {
+            if (__builtin_expect((unsigned)r >= (unsigned)n || (unsigned)l > (unsigned)r, 0)) invalidRange();
+            int bl = l / B, br = r / B;
+            if (bl == br) return at(inBlock(l, r));
+            Entry res = at(inBlock(l, bl * B + B - 1));
+            if (bl + 1 < br) {
+                int lo = bl + 1, hi = br - 1;
+                int k = 31 - __builtin_clz((unsigned)(hi - lo + 1));
+                const Entry* row = table.data() + (size_t)k * nb;
+                res = better(res, better(row[lo], row[hi - (1 << k) + 1]));
+            }
+            return better(res, at(inBlock(br * B, r)));
+        }
+
+    public:
+        LinearRMQ() = default;
+
+        explicit LinearRMQ(vector<T> arr, Compare c = Compare()) : a(move(arr)), cmp(c) {
+            build();
+        }
+
+        int queryIndex(int l, int r) const { return best(l, r).i; }
+
+        T query(int l, int r) const { return best(l, r).v; }
+
+        int size() const { return n; }
+    };
+#endif
+}
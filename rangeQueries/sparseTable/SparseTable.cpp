@@ -30,6 +30,31 @@ inline namespace MY{
             l, r      = 0-based inclusive query boundaries
             mode      = IDEMPOTENT or DISJOINT
             op        = binary associative operation (idempotent if IDEMPOTENT)
+
+
+        ===============================
+        SparseTableFlat<T, Op> Class — Function Complexities
+        ===============================
+
+        Same modes and query semantics as SparseTableGeneral, but Op is a functor type
+        (inlined into query) and all levels share one 64-byte-aligned buffer, level k
+        starting at k · stride. Levels are built one after another with a flat
+        __restrict loop over the previous level, which GCC vectorizes for min/max.
+        floor(log2) comes from __builtin_clz instead of a lookup table.
+
+        1. SparseTableFlat(a, mode)           → Constructor, build table from array | Time: O(n log n) | Space: O(n log n)
+        2. rebuild(a, mode)                   → Rebuild table from new array      | Time: O(n log n) | Space: O(n log n)
+        3. query(l, r)                        → Query range [l, r]               | Time: O(1)     | Space: O(1)
+        4. size()                             → Returns number of elements       | Time: O(1)     | Space: O(1)
+        5. debug_print()                       → Prints internal table for debug  | Time: O(n log n)| Space: O(n log n)
+
+        Ready-made ops: SparseMin<T>, SparseMax<T>, SparseGcd<T>, SparseAnd<T>, SparseOr<T> (idempotent, so both modes work);
+        any associative functor with `T operator()(const T&, const T&) const` works in DISJOINT mode.
+
+        Usage Example:
+            SparseTableFlat<int> mn(a);                                  // min, IDEMPOTENT
+            SparseTableFlat<long long, SparseGcd<long long>> g(b);
+            SparseTableFlat<long long, plus<long long>> s(b, SparseMode::DISJOINT);
     */
 
 
@@ -162,4 +187,146 @@ inline namespace MY{
             }
         }
     };
+
+
+#ifndef SPARSE_OPS_DEFINED
+#define SPARSE_OPS_DEFINED
+    template <typename T>
+    struct SparseMin {
+        T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+    };
+
+    template <typename T>
+    struct SparseMax {
+        T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+    };
+
+    template <typename T>
+    struct SparseGcd {
+        T operator()(const T& a, const T& b) const { return std::gcd(a, b); }
+    };
+
+    template <typename T>
+    struct SparseAnd {
+        T operator()(const T& a, const T& b) const { return a & b; }
+    };
+
+    template <typename T>
+    struct SparseOr {
+        T operator()(const T& a, const T& b) const { return a | b; }
+    };
+#endif
+
+    template <typename T, typename Op = SparseMin<T>>
+    class SparseTableFlat {
+    private:
+        static_assert(is_trivially_destructible<T>::value, "SparseTableFlat: T must be trivially destructible");
+        static constexpr size_t ALIGN = 64;
+
+        struct AlignedDeleter {
+            void operator()(T* p) const { ::operator delete[](p, align_val_t(ALIGN)); }
+        };
+
+        int n = 0;
+        int maxLog = 0;
+        size_t stride = 0;                    // level pitch in elements, multiple of ALIGN / sizeof(T)
+        unique_ptr<T[], AlignedDeleter> buf;
+        Op op;
+        SparseMode mode = SparseMode::IDEMPOTENT;
+
+        inline T* level(int k) const { return buf.get() + (size_t)k * stride; }
+
+        // Kept out of line so the O(1) query path stays small enough to inline
+        [[noreturn]] __attribute__((noinline, cold)) void invalidRange() const {
+            if (n == 0) throw out_of_range("SparseTableFlat: empty table");
+            throw out_of_range("SparseTableFlat::query - invalid range");
+        }
+
+        void allocate(int N) {
+            n = N;
+            maxLog = n ? 32 - __builtin_clz((unsigned)n) : 0;   // floor(log2(n)) + 1
+            size_t per = max<size_t>(1, ALIGN / sizeof(T));
+            stride = (n + per - 1) / per * per;
+            buf.reset();
+            if (n == 0) return;
+            buf.reset(static_cast<T*>(::operator new[](stride * maxLog * sizeof(T), align_val_t(ALIGN))));
+            std::uninitialized_value_construct_n(buf.get(), stride * maxLog);
+        }
+
+        void build_idempotent() {
+            for (int k = 1; k < maxLog; ++k) {
+                const T* __restrict prev = level(k - 1);
+                T* __restrict cur = level(k);
+                int half = 1 << (k - 1);
+                int cnt = n - (1 << k) + 1;
+                for (int i = 0; i < cnt; ++i) cur[i] = op(prev[i], prev[i + half]);
+            }
+        }
+
+        void build_disjoint() {
+            const T* a = level(0);
+            for (int k = 1; k < maxLog; ++k) {
+                T* cur = level(k);
+                int len = 1 << k;
+                int block = len << 1;
+                for (int left = 0; left < n; left += block) {
+                    int mid = min(left + len, n);
+                    int right = min(left + block, n);
+                    if (mid < right) {
+                        cur[mid] = a[mid];
+                        for (int i = mid + 1; i < right; ++i) cur[i] = op(cur[i - 1], a[i]);
+                    }
+                    cur[mid - 1] = a[mid - 1];
+                    for (int i = mid - 2; i >= left; --i) cur[i] = op(a[i], cur[i + 1]);
+                }
+            }
+        }
+
+    public:
+        SparseTableFlat() = default;
+
+        explicit SparseTableFlat(const vector<T>& a, SparseMode buildMode = SparseMode::IDEMPOTENT, Op operation = Op())
+            : op(operation) {
+            rebuild(a, buildMode);
+        }
+
+        void rebuild(const vector<T>& a, SparseMode buildMode = SparseMode::IDEMPOTENT) {
+            mode = buildMode;
+            allocate((int)a.size());
+            if (n == 0) return;
+            copy(a.begin(), a.end(), level(0));
+            if (mode == SparseMode::IDEMPOTENT) build_idempotent();
+            else build_disjoint();
+        }
+
+        // Query [l, r], 0-based inclusive
+        T query(int l, int r) const {
+            if (__builtin_expect((unsigned)r >= (unsigned)n || (unsigned)l > (unsigned)r, 0)) invalidRange();   // also catches l < 0
+
+            if (mode == SparseMode::IDEMPOTENT) {
+                int k = 31 - __builtin_clz((unsigned)(r - l + 1));
+                const T* row = level(k);
+                return op(row[l], row[r - (1 << k) + 1]);
+            }
+            if (l == r) return level(0)[l];
+            int k = 31 - __builtin_clz((unsigned)(l ^ r));
+            const T* row = level(k);
+            return op(row[l], row[r]);
+        }
+
+        int size() const noexcept { return n; }
+
+        void debug_print() const {
+            if (n == 0) { cout << "(empty)\n"; return; }
+            cout << "mode = " << (mode == SparseMode::IDEMPOTENT ? "IDEMPOTENT" : "DISJOINT") << "\n";
+            for (int k = 0; k < maxLog; ++k) {
+                cout << "k=" << k << " (len=" << (1 << k) << "): ";
+                for (int i = 0; i < n; ++i) {
+                    if (mode == SparseMode::IDEMPOTENT && i + (1 << k) > n) cout << "_ ";
+                    else cout << level(k)[i] << " ";
+                }
+                cout << "\n";
+            }
+        }
+    };
 }
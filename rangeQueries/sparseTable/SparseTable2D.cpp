@@ -0,0 +1,182 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        SparseTable2D<T, Op> Class — Function Complexities
+        ===============================
+
+        Immutable 2D sparse table for idempotent ops (min, max, gcd, and, or). Level (kx, ky)
+        holds op over the 2^kx × 2^ky block starting at each cell, and every level lives in
+        one contiguous buffer: level (kx, ky) is an n × m slab at offset (kx · LY + ky) · n · m.
+        A query combines the four (overlapping) corner blocks.
+
+        With a memory budget the number of levels per axis is capped (the larger axis is cut
+        first) until LX · LY · n · m · sizeof(T) fits. Rectangles taller or wider than the
+        largest stored block are then covered by a grid of overlapping blocks, so a query
+        costs ⌈h / 2^(LX-1)⌉ · ⌈w / 2^(LY-1)⌉ lookups instead of 4.
+
+        1. SparseTable2D(mat, budget, op)     → Build                            | Time: O(n m LX LY) | Space: O(n m LX LY)
+        2. query(x1, y1, x2, y2)              → op over the rectangle            | Time: O(1) uncapped, see above when capped
+        3. rows(), cols()                     → Matrix dimensions                | Time: O(1)
+        4. levels()                           → {LX, LY} actually stored         | Time: O(1)
+        5. memoryBytes()                      → Size of the table buffer         | Time: O(1)
+
+        Where:
+            n, m         = rows, columns;  LX <= floor(log2 n) + 1, LY <= floor(log2 m) + 1
+            x1,y1,x2,y2  = 0-based inclusive corners, invalid rectangles throw out_of_range
+            budget       = max table bytes, 0 = unlimited; a single level (the matrix itself)
+                           is always kept even if it exceeds the budget
+            Op           = idempotent functor: SparseMin / SparseMax / SparseGcd / SparseAnd / SparseOr
+
+        Usage Example:
+            SparseTable2D<int, SparseGcd<int>> g(mat);               // O(1) rectangle gcd
+            SparseTable2D<int> mn(mat, 256u << 20);                  // min, at most 256 MB
+            int v = mn.query(0, 0, 99, 4095);
+    */
+
+
+#ifndef SPARSE_OPS_DEFINED
+#define SPARSE_OPS_DEFINED
+    template <typename T>
+    struct SparseMin {
+        T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+    };
+
+    template <typename T>
+    struct SparseMax {
+        T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+    };
+
+    template <typename T>
+    struct SparseGcd {
+        T operator()(const T& a, const T& b) const { return std::gcd(a, b); }
+    };
+
+    template <typename T>
+    struct SparseAnd {
+        T operator()(const T& a, const T& b) const { return a & b; }
+    };
+
+    template <typename T>
+    struct SparseOr {
+        T operator()(const T& a, const T& b) const { return a | b; }
+    };
+#endif
+
+
+    template <typename T, typename Op = SparseMin<T>>
+    class SparseTable2D {
+    private:
+        int n = 0, m = 0;
+        int LX = 0, LY = 0;                 // stored levels per axis
+        size_t slab = 0;                    // n · m
+        vector<T> buf;
+        Op op;
+
+        inline const T* level(int kx, int ky) const { return buf.data() + ((size_t)kx * LY + ky) * slab; }
+        inline T* level(int kx, int ky) { return buf.data() + ((size_t)kx * LY + ky) * slab; }
+
+        static inline int lg(int x) { return 31 - __builtin_clz((unsigned)x); }
+
+        [[noreturn]] __attribute__((noinline, cold)) void invalidRect() const {
+            if (n == 0 || m == 0) throw out_of_range("SparseTable2D: empty table");
+            throw out_of_range("SparseTable2D::query - invalid rectangle");
+        }
+
+        // Capped query: cover [x1, x2] × [y1, y2] with overlapping 2^kx × 2^ky blocks
+        T queryTiled(int x1, int y1, int x2, int y2, int kx, int ky) const {
+            const T* L = level(kx, ky);
+            int bx = 1 << kx, by = 1 << ky;
+            T res = L[(size_t)x1 * m + y1];
+            for (int i = x1; ; i += bx) {
+                int ii = min(i, x2 - bx + 1);
+                for (int j = y1; ; j += by) {
+                    int jj = min(j, y2 - by + 1);
+                    res = op(res, L[(size_t)ii * m + jj]);
+                    if (jj == y2 - by + 1) break;
+                }
+                if (ii == x2 - bx + 1) break;
+            }
+            return res;
+        }
+
+    public:
+        SparseTable2D() = default;
+
+        explicit SparseTable2D(const vector<vector<T>>& mat, size_t budgetBytes = 0, Op operation = Op())
+            : op(operation) {
+            n = (int)mat.size();
+            m = n ? (int)mat[0].size() : 0;
+            if (n == 0 || m == 0) { n = m = 0; return; }
+            slab = (size_t)n * m;
+
+            LX = lg(n) + 1;
+            LY = lg(m) + 1;
+            if (budgetBytes) {
+                size_t cap = max<size_t>(1, budgetBytes / (slab * sizeof(T)));
+                while ((size_t)LX * LY > cap && (LX > 1 || LY > 1)) {
+                    if (LX >= LY) LX--;
+                    else LY--;
+                }
+            }
+            buf.resize((size_t)LX * LY * slab);
+
+            T* base = level(0, 0);
+            for (int i = 0; i < n; i++) {
+                if ((int)mat[i].size() != m) throw invalid_argument("SparseTable2D: ragged matrix");
+                copy(mat[i].begin(), mat[i].end(), base + (size_t)i * m);
+            }
+            // along columns inside level kx = 0, then every (kx, ky) from (kx - 1, ky)
+            for (int ky = 1; ky < LY; ky++) {
+                const T* __restrict prev = level(0, ky - 1);
+                T* __restrict cur = level(0, ky);
+                int half = 1 << (ky - 1), cnt = m - (1 << ky) + 1;
+                for (int i = 0; i < n; i++) {
+                    const T* p = prev + (size_t)i * m;
+                    T* c = cur + (size_t)i * m;
+                    for (int j = 0; j < cnt; j++) c[j] = op(p[j], p[j + half]);
+                }
+            }
+            for (int kx = 1; kx < LX; kx++) {
+                int half = 1 << (kx - 1), rowsCnt = n - (1 << kx) + 1;
+                for (int ky = 0; ky < LY; ky++) {
+                    const T* __restrict prev = level(kx - 1, ky);
+                    T* __restrict cur = level(kx, ky);
+                    int cnt = m - (1 << ky) + 1;
+                    for (int i = 0; i < rowsCnt; i++) {
+                        const T* a = prev + (size_t)i * m;
+                        const T* b = prev + (size_t)(i + half) * m;
+                        T* c = cur + (size_t)i * m;
+                        for (int j = 0; j < cnt; j++) c[j] = op(a[j], b[j]);
+                    }
+                }
+            }
+        }
+
+        // op over [x1, x2] × [y1, y2], 0-based inclusive
+        T query(int x1, int y1, int x2, int y2) const {
+            if (__builtin_expect((unsigned)x2 >= (unsigned)n || (unsigned)x1 > (unsigned)x2 ||
+                                 (unsigned)y2 >= (unsigned)m || (unsigned)y1 > (unsigned)y2, 0)) invalidRect();
+            int kx = lg(x2 - x1 + 1), ky = lg(y2 - y1 + 1);
+            if (__builtin_expect(kx >= LX || ky >= LY, 0))
+                return queryTiled(x1, y1, x2, y2, min(kx, LX - 1), min(ky, LY - 1));
+            const T* L = level(kx, ky);
+            int x3 = x2 - (1 << kx) + 1, y3 = y2 - (1 << ky) + 1;
+            return op(op(L[(size_t)x1 * m + y1], L[(size_t)x1 * m + y3]),
+                      op(L[(size_t)x3 * m + y1], L[(size_t)x3 * m + y3]));
+        }
+
+        int rows() const noexcept { return n; }
+        int cols() const noexcept { return m; }
+        pair<int, int> levels() const noexcept { return {LX, LY}; }
+        size_t memoryBytes() const noexcept { return buf.size() * sizeof(T); }
+    };
+}
@@ -25,6 +25,7 @@ inline namespace MY{
         Usage Example:
             SqrtDecomposition<long long> ds(arr,
                 [&](long long a,long long b){ return a+b; }, 0LL, true);
+        For lazy actions other than "add under sum" use SqrtDecompositionLazy<Policy> below.
     */
 
 
@@ -115,4 +116,306 @@ inline namespace MY{
             return res;
         }
     };
+
+
+
+    /*
+        ===============================
+        SqrtDecompositionLazy<Policy> Class — Function Complexities
+        ===============================
+
+        Block decomposition with any monoid + lazy action, using the same Policy interface
+        as SegTreeLazy (SumAddPolicy, MinAddPolicy, SumAssignPolicy, AffineSumPolicy, ...).
+        Every block keeps its aggregate with all pending actions applied and one pending
+        action; partial blocks push it down to the elements before being modified.
+
+        1. SqrtDecompositionLazy(arr, B = 0)       → Constructor (B = 0 → √n)    | Time: O(n)         | Space: O(n)
+        2. rangeApply(L, R, f)                     → Apply action f to [L, R]    | Time: O(B + n / B) | Space: O(1)
+        3. pointSet(pos, x)                        → Overwrite element pos by x  | Time: O(B)         | Space: O(1)
+        4. rangeQuery(L, R)                        → op over [L, R]              | Time: O(B + n / B) | Space: O(1)
+        5. pointQuery(pos)                         → Element at pos              | Time: O(1)         | Space: O(1)
+        6. setBlockSize(B)                         → Re-block the current data   | Time: O(n)         | Space: O(n)
+        7. calibrate(queryRanges, updateRanges)    → Time a sample of the caller's real operations on a copy
+                                                     of the live data for B = 2^k in [√n / 16, 16√n], keep the fastest
+                                                     | Time: O((n + samples · √n) · log n)
+        8. calibrate(updateRatio, samples, seed, maxLen)
+                                                   → Same without a sample: uniform ranges of length <= maxLen
+        9. blockSize(), size()                     → Current B / number of elements | Time: O(1)
+
+        Where:
+            n    = number of elements, B = block size
+            L,R  = 0-based inclusive range boundaries
+            f    = lazy action (Policy::F), mapping(f, x, 1) is applied per element
+            updateRatio = expected fraction of rangeApply among all operations; update-heavy
+                   workloads usually land on a B different from √n because a partial-block
+                   update costs a push + rebuild while a partial-block query is a single scan.
+
+        Usage Example:
+            SqrtDecompositionLazy<AffineSumPolicy<long long>> ds(arr);
+            ds.calibrate(0.8);                      // 80% updates, uniform ranges
+            ds.calibrate(sampleQueries, sampleUpdates); // or: (l, r) pairs logged from the real workload
+            ds.rangeApply(2, 9, {2, 1});            // x -> 2x + 1
+            long long s = ds.rangeQuery(0, 9);
+    */
+
+
+#ifndef LAZY_POLICIES_DEFINED
+#define LAZY_POLICIES_DEFINED
+
+    template <typename T>
+    struct SumAddPolicy {
+        using S = T;
+        using F = T;
+        static S e() { return T(0); }
+        static S op(const S& a, const S& b) { return a + b; }
+        static F id() { return T(0); }
+        static S mapping(const F& f, const S& x, int len) { return x + f * len; }
+        static F composition(const F& f, const F& g) { return f + g; }
+    };
+
+    template <typename T>
+    struct MinAddPolicy {
+        using S = T;
+        using F = T;
+        static S e() { return numeric_limits<T>::max(); }
+        static S op(const S& a, const S& b) { return min(a, b); }
+        static F id() { return T(0); }
+        static S mapping(const F& f, const S& x, int) { return x == e() ? x : x + f; }
+        static F composition(const F& f, const F& g) { return f + g; }
+    };
+
+    template <typename T>
+    struct MaxAddPolicy {
+        using S = T;
+        using F = T;
+        static S e() { return numeric_limits<T>::lowest(); }
+        static S op(const S& a, const S& b) { return max(a, b); }
+        static F id() { return T(0); }
+        static S mapping(const F& f, const S& x, int) { return x == e() ? x : x + f; }
+        static F composition(const F& f, const F& g) { return f + g; }
+    };
+
+    template <typename T>
+    struct SumAssignPolicy {
+        struct F { T val; bool has; };
+        using S = T;
+        static S e() { return T(0); }
+        static S op(const S& a, const S& b) { return a + b; }
+        static F id() { return F{T(0), false}; }
+        static S mapping(const F& f, const S& x, int len) { return f.has ? f.val * len : x; }
+        static F composition(const F& f, const F& g) { return f.has ? f : g; }
+    };
+
+    template <typename T>
+    struct AffineSumPolicy {
+        struct F { T b, c; };  // x -> b*x + c
+        using S = T;
+        static S e() { return T(0); }
+        static S op(const S& a, const S& b) { return a + b; }
+        static F id() { return F{T(1), T(0)}; }
+        static S mapping(const F& f, const S& x, int len) { return f.b * x + f.c * len; }
+        static F composition(const F& f, const F& g) { return F{f.b * g.b, f.b * g.c + f.c}; }
+    };
+
+    template <typename T>
+    struct SumMinMaxAddAssignPolicy {
+        struct S {
+            T sum, mn, mx;
+            S(): sum(0), mn(numeric_limits<T>::max()), mx(numeric_limits<T>::lowest()) {}
+            S(T v): sum(v), mn(v), mx(v) {}
+            S(T s, T a, T b): sum(s), mn(a), mx(b) {}
+        };
+        struct F { T add, assignVal; bool hasAssign; };
+        static S e() { return S(); }
+        static S op(const S& a, const S& b) {
+            __int128 tmp = (__int128)a.sum + (__int128)b.sum;
+            return S((T)tmp, min(a.mn, b.mn), max(a.mx, b.mx));
+        }
+        static F id() { return F{T(0), T(0), false}; }
+        static S mapping(const F& f, const S& x, int len) {
+            if (f.hasAssign) {
+                T v = f.assignVal + f.add;
+                return S((T)((__int128)v * len), v, v);
+            }
+            if (f.add == T(0)) return x;
+            S res = x;
+            res.sum = (T)((__int128)x.sum + (__int128)f.add * len);
+            if (res.mn != numeric_limits<T>::max()) res.mn += f.add;
+            if (res.mx != numeric_limits<T>::lowest()) res.mx += f.add;
+            return res;
+        }
+        static F composition(const F& f, const F& g) {
+            if (f.hasAssign) return f;
+            return F{g.add + f.add, g.assignVal, g.hasAssign};
+        }
+    };
+
+#endif
+
+
+    template <typename Policy>
+    class SqrtDecompositionLazy {
+    public:
+        using S = typename Policy::S;
+        using F = typename Policy::F;
+
+    private:
+        int n = 0, B = 1, numBlocks = 0;
+        vector<S> arr;                 // elements, excluding their block's pending action
+        vector<S> blockValue;          // aggregate per block, pending action included
+        vector<F> lazy;                // pending action per block
+        vector<char> dirty;            // lazy[b] != id()
+
+        inline int blockEnd(int b) const { return min(n, (b + 1) * B); }
+
+        void push(int b) {
+            if (!dirty[b]) return;
+            for (int i = b * B, e = blockEnd(b); i < e; i++) arr[i] = Policy::mapping(lazy[b], arr[i], 1);
+            lazy[b] = Policy::id();
+            dirty[b] = 0;
+        }
+
+        void rebuildBlock(int b) {
+            S v = Policy::e();
+            for (int i = b * B, e = blockEnd(b); i < e; i++) v = Policy::op(v, arr[i]);
+            blockValue[b] = v;
+        }
+
+        // op over arr[l..r] inside block b, pending action applied on the fly
+        S scan(int b, int l, int r) const {
+            S v = Policy::e();
+            if (dirty[b]) for (int i = l; i <= r; i++) v = Policy::op(v, Policy::mapping(lazy[b], arr[i], 1));
+            else for (int i = l; i <= r; i++) v = Policy::op(v, arr[i]);
+            return v;
+        }
+
+        void applyPartial(int b, int l, int r, const F& f) {
+            push(b);
+            for (int i = l; i <= r; i++) arr[i] = Policy::mapping(f, arr[i], 1);
+            rebuildBlock(b);
+        }
+
+        void check(int l, int r) const {
+            if (l < 0 || r >= n || l > r) throw out_of_range("SqrtDecompositionLazy: invalid range");
+        }
+
+        // Times wq-weighted queries over qs and wu-weighted identity updates over us (same work
+        // as real actions) for B = 2^k around √n on a copy of the current data, re-blocks to
+        // the cheapest per-op mix and returns B
+        int calibrateOn(const vector<pair<int, int>>& qs, const vector<pair<int, int>>& us, double wq, double wu) {
+            vector<S> cur(n);
+            for (int i = 0; i < n; i++) cur[i] = pointQuery(i);
+
+            using clk = chrono::steady_clock;
+            int best = B;
+            double bestCost = numeric_limits<double>::max();
+            int root = max(1, (int)sqrt(n));
+            int lo = max(1, root / 16), hi = min(n, root * 16);
+            for (int cand = 1 << (31 - __builtin_clz(lo)); ; cand <<= 1) {
+                int c = min(cand, hi);
+                SqrtDecompositionLazy trial(cur, c);
+                S sink = Policy::e();
+
+                auto t0 = clk::now();
+                for (auto& [l, r] : qs) sink = Policy::op(sink, trial.rangeQuery(l, r));
+                auto t1 = clk::now();
+                for (auto& [l, r] : us) trial.rangeApply(l, r, Policy::id());
+                auto t2 = clk::now();
+                asm volatile("" : : "g"(&sink) : "memory");
+
+                double q = qs.empty() ? 0 : chrono::duration<double>(t1 - t0).count() / qs.size();
+                double u = us.empty() ? 0 : chrono::duration<double>(t2 - t1).count() / us.size();
+                double cost = wq * q + wu * u;
+                if (cost < bestCost) { bestCost = cost; best = c; }
+                if (c == hi) break;
+            }
+            setBlockSize(best);
+            return best;
+        }
+
+    public:
+        explicit SqrtDecompositionLazy(const vector<S>& a, int blockSz = 0) : arr(a) {
+            n = arr.size();
+            setBlockSize(blockSz);
+        }
+
+        void setBlockSize(int blockSz) {
+            for (int b = 0; b < numBlocks; b++) push(b);
+            B = blockSz > 0 ? blockSz : max(1, (int)sqrt(n));
+            numBlocks = (n + B - 1) / B;
+            blockValue.assign(numBlocks, Policy::e());
+            lazy.assign(numBlocks, Policy::id());
+            dirty.assign(numBlocks, 0);
+            for (int b = 0; b < numBlocks; b++) rebuildBlock(b);
+        }
+
+        void rangeApply(int l, int r, const F& f) {
+            check(l, r);
+            int bL = l / B, bR = r / B;
+            if (bL == bR) { applyPartial(bL, l, r, f); return; }
+            applyPartial(bL, l, blockEnd(bL) - 1, f);
+            for (int b = bL + 1; b < bR; b++) {
+                blockValue[b] = Policy::mapping(f, blockValue[b], blockEnd(b) - b * B);
+                lazy[b] = Policy::composition(f, lazy[b]);
+                dirty[b] = 1;
+            }
+            applyPartial(bR, bR * B, r, f);
+        }
+
+        void pointSet(int i, const S& x) {
+            check(i, i);
+            int b = i / B;
+            push(b);
+            arr[i] = x;
+            rebuildBlock(b);
+        }
+
+        S rangeQuery(int l, int r) const {
+            check(l, r);
+            int bL = l / B, bR = r / B;
+            if (bL == bR) return scan(bL, l, r);
+            S res = scan(bL, l, blockEnd(bL) - 1);
+            for (int b = bL + 1; b < bR; b++) res = Policy::op(res, blockValue[b]);
+            return Policy::op(res, scan(bR, bR * B, r));
+        }
+
+        S pointQuery(int i) const {
+            check(i, i);
+            int b = i / B;
+            return dirty[b] ? Policy::mapping(lazy[b], arr[i], 1) : arr[i];
+        }
+
+        // Calibrates on a sample of the caller's own operations: the ranges of real queries
+        // and of real updates, weighted by how many of each were given. Returns B.
+        int calibrate(const vector<pair<int, int>>& queryRanges, const vector<pair<int, int>>& updateRanges) {
+            if (n == 0 || (queryRanges.empty() && updateRanges.empty())) return B;
+            for (auto& [l, r] : queryRanges) check(l, r);
+            for (auto& [l, r] : updateRanges) check(l, r);
+            return calibrateOn(queryRanges, updateRanges, (double)queryRanges.size(), (double)updateRanges.size());
+        }
+
+        // Fallback without a sample: uniformly random ranges of length at most maxLen
+        // (0 → n), mixed as (1 - updateRatio) queries and updateRatio updates. Returns B.
+        int calibrate(double updateRatio, int samples = 2000, unsigned seed = 12345, int maxLen = 0) {
+            if (n == 0) return B;
+            updateRatio = min(1.0, max(0.0, updateRatio));
+            int len = maxLen > 0 ? min(maxLen, n) : n;
+
+            mt19937 rng(seed);
+            vector<pair<int, int>> ranges(samples);
+            for (auto& [l, r] : ranges) {
+                if (len == n) {
+                    l = rng() % n; r = rng() % n;
+                    if (l > r) swap(l, r);
+                } else {
+                    l = rng() % n;
+                    r = min(n - 1, l + (int)(rng() % len));
+                }
+            }
+            return calibrateOn(ranges, ranges, 1 - updateRatio, updateRatio);
+        }
+
+        int blockSize() const { return B; }
+        int size() const { return n; }
+    };
 }
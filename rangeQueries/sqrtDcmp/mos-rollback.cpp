@@ -0,0 +1,163 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+
+    /*
+        ===============================
+        MosRollback Class — Function Complexities
+        ===============================
+
+        Mo's algorithm for statistics that support insertion but not deletion (max frequency,
+        longest run, ...). Queries are grouped by the block of l; inside a block they are
+        sorted by r, the right part grows monotonically from the block end, and the left part
+        [l, blockEnd) is added on top of a snapshot and rolled back after answering. Queries
+        with both ends in the same block are answered by brute force on an empty state.
+
+        1. MosRollback(arr)                  → Constructor, builds Policy(arr) | Time: O(n) + Policy | Space: O(n)
+        2. MosRollback(n, policy)            → Constructor from a ready policy object | Time: O(1) | Space: O(1)
+        3. addQuery(l, r, idx)               → Add a query for range [l, r] with answer index idx | Time: O(1) | Space: O(1)
+        4. process()                         → Answer all queries in original order | Time: O(n * √q + q log q) | Space: O(n + q)
+        5. policy()                          → Access the user state | Time: O(1)
+
+        --- Policy (same shape as MosAlgorithm's, with remove replaced by undo hooks) ---
+            Policy(const vector<T>& arr)      → Build the state for an empty range
+            void add(int idx)                 → Element idx enters the current range
+            void snapshot()                   → Remember the current state (one level)
+            void rollback()                   → Restore the state saved by snapshot()
+            void clear()                      → Back to the empty range
+            AnswerType answer()               → Answer for the current range
+        MosMaxFrequency<T> (default) answers "highest number of occurrences of one value";
+        it undoes via a journal of touched slots, so rollback/clear cost what was added.
+
+        Where:
+        n = size of the input array
+        q = number of queries, block size B = n / √q
+        l, r = 0-based inclusive indices for queries
+        idx = query index in original order
+
+        Usage Example:
+            vector<int> arr = {1,2,1,3,1,2};
+            MosRollback<int> mos(arr);
+            mos.addQuery(0, 4, 0);          // 3 (value 1)
+            mos.addQuery(1, 5, 1);          // 2
+            vector<long long> ans = mos.process();
+    */
+
+
+
+    template <typename T, typename AnswerType = long long>
+    class MosMaxFrequency {
+        vector<int> comp;                   // compressed value per position
+        vector<int> freq;                   // one slot per distinct value
+        vector<int> journal;                // slots incremented since clear(), in order
+        AnswerType best = 0;
+        size_t savedSize = 0;
+        AnswerType savedBest = 0;
+
+        void undoTo(size_t size) {
+            while (journal.size() > size) { freq[journal.back()]--; journal.pop_back(); }
+        }
+
+    public:
+        explicit MosMaxFrequency(const vector<T>& arr) : comp(arr.size()) {
+            vector<T> vals(arr);
+            sort(vals.begin(), vals.end());
+            vals.erase(unique(vals.begin(), vals.end()), vals.end());
+            for (size_t i = 0; i < arr.size(); i++)
+                comp[i] = int(lower_bound(vals.begin(), vals.end(), arr[i]) - vals.begin());
+            freq.assign(vals.size(), 0);
+        }
+
+        void add(int idx) {
+            int c = comp[idx];
+            journal.push_back(c);
+            best = max(best, (AnswerType)++freq[c]);
+        }
+
+        void snapshot() { savedSize = journal.size(); savedBest = best; }
+        void rollback() { undoTo(savedSize); best = savedBest; }
+        void clear() { undoTo(0); best = 0; savedSize = 0; savedBest = 0; }
+        AnswerType answer() const { return best; }
+    };
+
+
+
+    template <typename T, typename AnswerType = long long, typename Policy = MosMaxFrequency<T, AnswerType>>
+    class MosRollback {
+    private:
+        struct Query {
+            int l, r, idx;
+            Query(int l, int r, int idx) : l(l), r(r), idx(idx) {}
+        };
+
+        int n;
+        Policy state;
+        vector<Query> queries;
+        vector<AnswerType> answers;
+
+    public:
+        explicit MosRollback(const vector<T>& a) : MosRollback((int)a.size(), Policy(a)) {}
+
+        MosRollback(int size, Policy p) : n(size), state(move(p)) {}
+
+        // Add a query [l, r] (0-based inclusive)
+        void addQuery(int l, int r, int idx) {
+            if (l < 0 || r >= n || l > r) throw out_of_range("MosRollback::addQuery - invalid range");
+            queries.emplace_back(l, r, idx);
+        }
+
+        // Answer all queries (the policy starts from and is returned to the empty range)
+        vector<AnswerType> process() {
+            int q = queries.size();
+            answers.assign(q, AnswerType());
+            if (q == 0) return answers;
+
+            int blockSize = max(1, (int)(n / sqrt((double)q)));
+            sort(queries.begin(), queries.end(), [&](const Query& a, const Query& b) {
+                int blockA = a.l / blockSize, blockB = b.l / blockSize;
+                if (blockA != blockB) return blockA < blockB;
+                return a.r < b.r;
+            });
+
+            for (int i = 0; i < q; ) {
+                int block = queries[i].l / blockSize;
+                int blockEnd = min(n, (block + 1) * blockSize);      // first index after the block
+                int j = i;
+                while (j < q && queries[j].l / blockSize == block) j++;
+
+                // short queries: brute force on an empty state
+                for (int k = i; k < j; k++) {
+                    const Query& cur = queries[k];
+                    if (cur.r >= blockEnd) continue;
+                    for (int x = cur.l; x <= cur.r; x++) state.add(x);
+                    answers[cur.idx] = state.answer();
+                    state.clear();
+                }
+
+                // long queries: right part [blockEnd, R] only grows, left part is rolled back
+                int R = blockEnd - 1;
+                for (int k = i; k < j; k++) {
+                    const Query& cur = queries[k];
+                    if (cur.r < blockEnd) continue;
+                    while (R < cur.r) state.add(++R);
+                    state.snapshot();
+                    for (int x = blockEnd - 1; x >= cur.l; x--) state.add(x);
+                    answers[cur.idx] = state.answer();
+                    state.rollback();
+                }
+                state.clear();
+                i = j;
+            }
+            return answers;
+        }
+
+        Policy& policy() { return state; }
+    };
+}
@@ -14,25 +14,45 @@ inline namespace MY{
         MosAlgorithm Class — Function Complexities
         ===============================
 
-        1. MosAlgorithm(arr)                 → Constructor | Time: O(n) | Space: O(n)
-        2. addQuery(l, r, idx)              → Add a query for range [l, r] with answer index idx | Time: O(1) | Space: O(1)
-        3. process()                         → Run Mo's algorithm and return answers in original order | Time: O((n+q) * √n) | Space: O(n + q)
-
-        --- Internal / User-defined Helpers ---
-        4. add(idx)                          → Add element at index idx to current range | Time: O(1) | Space: O(1)
-        5. remove(idx)                       → Remove element at index idx from current range | Time: O(1) | Space: O(1)
+        1. MosAlgorithm(arr, order)          → Constructor, builds Policy(arr) | Time: O(n) + Policy | Space: O(n)
+        2. MosAlgorithm(n, policy, order)    → Constructor from a ready policy object | Time: O(1) | Space: O(1)
+        3. addQuery(l, r, idx)              → Add a query for range [l, r] with answer index idx | Time: O(1) | Space: O(1)
+        4. process()                         → Run Mo's algorithm and return answers in original order | Time: O(n * √q + q log q) | Space: O(n + q)
+        5. processParallel(threads)          → Same answers; the sorted queries are cut into `threads` contiguous
+                                               chunks, each swept by its own copy of the policy | Time: O((n * √q + n * threads) / threads + q log q) | Space: O(n + q + threads · |Policy|)
+        6. policy()                          → Access the user state (e.g. to reset it) | Time: O(1)
+
+        --- Policy (user-defined state, the only thing to write per problem) ---
+            Policy(const vector<T>& arr)      → Build the state for an empty range
+            void add(int idx)                 → Element idx enters the current range
+            void remove(int idx)              → Element idx leaves the current range
+            AnswerType answer()               → Answer for the current range
+        For processParallel the policy must be copyable, and copies must not share mutable state.
+        Workers are plain std::threads started and joined inside the call (fork-join, no pool
+        kept alive between calls): a call does O(n · √q) work, next to which thread start-up
+        (tens of µs) does not show, and nothing is left running once answers are returned.
+        MosDistinctCount<T, AnswerType> (default) counts distinct values; values are
+        coordinate-compressed in its constructor, so its frequency table has one slot
+        per distinct value instead of a fixed 10^6.
+
+        --- Query order (MosOrder) ---
+            BLOCK    → (l / B, r) with odd-even alternation of r, B = n / √q
+            HILBERT  → position of (l, r) on a Hilbert curve over [0, 2^k)²; no block size to
+                       tune, on par with BLOCK for uniform random ranges and 2-5x fewer
+                       add/remove calls when ranges are short or clustered
 
         Where:
         n = size of the input array
         q = number of queries
         l, r = 0-based inclusive indices for queries
         idx = query index in original order
-        AnswerType = type of the result (long long by default)
-        currentAnswer = user-defined state updated by add/remove functions
+        AnswerType = type of the result (long long by default; not bool, since workers
+                     write answers concurrently — rejected at compile time)
+        threads = worker count (0 = hardware_concurrency)
 
         Usage Example:
             vector<int> arr = {1,2,1,3,2};
-            MosAlgorithm<int> mos(arr);
+            MosAlgorithm<int> mos(arr, MosOrder::HILBERT);
             mos.addQuery(0, 2, 0);
             mos.addQuery(1, 3, 1);
             mos.addQuery(2, 4, 2);
@@ -41,74 +61,177 @@ inline namespace MY{
 
 
 
+#ifndef MOS_COMMON_DEFINED
+#define MOS_COMMON_DEFINED
+    enum class MosOrder { BLOCK, HILBERT };
+
+    // Index of (x, y) along the Hilbert curve filling [0, 2^pw)²
+    inline uint64_t hilbertOrder(int x, int y, int pw) {
+        uint64_t d = 0;
+        int side = 1 << pw;
+        for (int s = side >> 1; s > 0; s >>= 1) {
+            int rx = (x & s) > 0, ry = (y & s) > 0;
+            d += (uint64_t)s * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) { x = side - 1 - x; y = side - 1 - y; }
+                swap(x, y);
+            }
+        }
+        return d;
+    }
+
     template <typename T, typename AnswerType = long long>
+    class MosDistinctCount {
+        vector<int> comp;                   // compressed value per position
+        vector<int> freq;                   // one slot per distinct value
+        AnswerType distinct = 0;
+
+    public:
+        explicit MosDistinctCount(const vector<T>& arr) : comp(arr.size()) {
+            vector<T> vals(arr);
+            sort(vals.begin(), vals.end());
+            vals.erase(unique(vals.begin(), vals.end()), vals.end());
+            for (size_t i = 0; i < arr.size(); i++)
+                comp[i] = int(lower_bound(vals.begin(), vals.end(), arr[i]) - vals.begin());
+            freq.assign(vals.size(), 0);
+        }
+
+        void add(int idx) { if (freq[comp[idx]]++ == 0) distinct++; }
+        void remove(int idx) { if (--freq[comp[idx]] == 0) distinct--; }
+        AnswerType answer() const { return distinct; }
+
+        // MosAlgorithmWithUpdates: position idx takes the value of slot src
+        void assign(int idx, int src) { comp[idx] = comp[src]; }
+    };
+#endif
+
+
+
+#ifndef PARALLEL_HELPERS_DEFINED
+#define PARALLEL_HELPERS_DEFINED
+    // Worker count for a `threads` argument: 0 means hardware_concurrency, never below 1
+    inline int resolveThreads(int threads) {
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        return max(1, threads);
+    }
+
+    // Depth of the subtree frontier split among workers, ~4 subtrees per worker for balance
+    inline int frontierDepth(int threads) {
+        int d = 0;
+        while ((1 << d) < 4 * threads) ++d;
+        return d;
+    }
+
+    // Runs job(i) for i in [0, tasks) on `threads` workers, contiguous blocks per worker
+    template <typename Job>
+    void runParallel(int tasks, int threads, Job job) {
+        threads = min(threads, tasks);
+        if (threads <= 1) { for (int i = 0; i < tasks; ++i) job(i); return; }
+        vector<thread> pool;
+        pool.reserve(threads);
+        for (int t = 0; t < threads; ++t) {
+            int from = (int)((long long)tasks * t / threads);
+            int to = (int)((long long)tasks * (t + 1) / threads);
+            pool.emplace_back([from, to, &job]() { for (int i = from; i < to; ++i) job(i); });
+        }
+        for (auto& th : pool) th.join();
+    }
+#endif
+
+
+    template <typename T, typename AnswerType = long long, typename Policy = MosDistinctCount<T, AnswerType>>
     class MosAlgorithm {
     private:
         struct Query {
             int l, r, idx;
+            uint64_t key = 0;               // Hilbert position (HILBERT order only)
             Query(int l, int r, int idx) : l(l), r(r), idx(idx) {}
         };
 
         int n;                              // array size
-        int blockSize;                      // sqrt decomposition block size
-        const vector<T>& arr;               // reference to input array
+        int blockSize;                      // BLOCK order bucket width, n / √q
+        MosOrder order;
+        Policy state;                       // user-defined add/remove state
         vector<Query> queries;              // all queries
         vector<AnswerType> answers;         // results in original order
 
-        // User-defined state
-        AnswerType currentAnswer = 0;
-        vector<int> freq;                   // example: frequency table
-
-        // User must customize add/remove functions
-        void add(int idx) {
-            // Example: count distinct elements
-            int x = arr[idx];
-            freq[x]++;
-            if (freq[x] == 1) currentAnswer++;
+        // Answers sorted queries [from, to) starting from (and returning st to) the empty range
+        void sweep(Policy& st, int from, int to) {
+            int L = 0, R = -1;
+            for (int i = from; i < to; i++) {
+                const Query& q = queries[i];
+                while (L > q.l) st.add(--L);
+                while (R < q.r) st.add(++R);
+                while (L < q.l) st.remove(L++);
+                while (R > q.r) st.remove(R--);
+                answers[q.idx] = st.answer();
+            }
+            while (L <= R) st.remove(L++);
         }
 
-        void remove(int idx) {
-            int x = arr[idx];
-            freq[x]--;
-            if (freq[x] == 0) currentAnswer--;
+        void sortQueries() {
+            if (order == MosOrder::HILBERT) {
+                int pw = 0;
+                while ((1 << pw) < n) pw++;
+                for (auto& q : queries) q.key = hilbertOrder(q.l, q.r, pw);
+                sort(queries.begin(), queries.end(), [](const Query& a, const Query& b) { return a.key < b.key; });
+                return;
+            }
+            blockSize = max(1, (int)(n / sqrt(max<size_t>(1, queries.size()))));
+            sort(queries.begin(), queries.end(), [&](const Query& a, const Query& b) {
+                int blockA = a.l / blockSize;
+                int blockB = b.l / blockSize;
+                if (blockA != blockB) return blockA < blockB;
+                return (blockA & 1) ? (a.r > b.r) : (a.r < b.r); // odd-even alternation
+            });
         }
 
     public:
-        MosAlgorithm(const vector<T>& a)
-            : n((int)a.size()), arr(a) {
-            blockSize = max(1, (int)sqrt(n));
-            freq.assign(1e6 + 5, 0); // adjust if needed for value range
-        }
+        explicit MosAlgorithm(const vector<T>& a, MosOrder ord = MosOrder::BLOCK)
+            : MosAlgorithm((int)a.size(), Policy(a), ord) {}
+
+        MosAlgorithm(int size, Policy p, MosOrder ord = MosOrder::BLOCK)
+            : n(size), blockSize(1), order(ord), state(move(p)) {}
 
         // Add a query [l, r] (0-based inclusive)
         void addQuery(int l, int r, int idx) {
+            if (l < 0 || r >= n || l > r) throw out_of_range("MosAlgorithm::addQuery - invalid range");
             queries.emplace_back(l, r, idx);
         }
 
         // Run Mo’s algorithm and return answers
+        // (the policy starts from and is returned to the empty range)
         vector<AnswerType> process() {
-            int q = queries.size();
-            answers.assign(q, 0);
-
-            // Sort queries
-            sort(queries.begin(), queries.end(), [&](const Query& a, const Query& b) {
-                int blockA = a.l / blockSize;
-                int blockB = b.l / blockSize;
-                if (blockA != blockB) return blockA < blockB;
-                return (blockA & 1) ? (a.r > b.r) : (a.r < b.r); // optimization: Hilbert-like ordering
-            });
-
-            // Current range [L, R]
-            int L = 0, R = -1;
+            answers.assign(queries.size(), AnswerType());
+            sortQueries();
+            sweep(state, 0, (int)queries.size());
+            return answers;
+        }
 
-            for (auto& q : queries) {
-                while (L > q.l) add(--L);
-                while (R < q.r) add(++R);
-                while (L < q.l) remove(L++);
-                while (R > q.r) remove(R--);
-                answers[q.idx] = currentAnswer;
+        // Each worker copies the (empty) policy, so chunks are fully independent;
+        // every chunk pays one O(n) walk from the empty range to its first query
+        vector<AnswerType> processParallel(int threads = 0) {
+            static_assert(!is_same_v<AnswerType, bool>, "processParallel: vector<bool> answers would race, use char");
+            int q = queries.size();
+            answers.assign(q, AnswerType());
+            sortQueries();
+            threads = min(resolveThreads(threads), max(1, q));
+            if (threads == 1) { sweep(state, 0, q); return answers; }
+
+            vector<thread> pool;
+            pool.reserve(threads);
+            for (int t = 0; t < threads; ++t) {
+                int from = (int)((long long)q * t / threads);
+                int to = (int)((long long)q * (t + 1) / threads);
+                pool.emplace_back([this, from, to] {
+                    Policy local(state);
+                    sweep(local, from, to);
+                });
             }
+            for (auto& th : pool) th.join();
             return answers;
         }
+
+        Policy& policy() { return state; }
     };
 }
@@ -17,25 +17,35 @@ inline namespace MY {
         2. addQuery(l, r, idx)                   → Add a query [l, r] with output index idx | Time: O(1)
         3. addUpdate(pos, newVal)                → Add an update operation | Time: O(1)
         4. process()                             → Run Mo’s algorithm with updates | Time: O((n + q) * n^(2/3)) approx | Space: O(n + q + u)
+        5. processParallel(threads)              → Same answers; sorted queries cut into `threads` contiguous chunks,
+                                                   each swept by its own policy copy | Time: process() / threads + O(threads · (n + u))
+                                                   threads are spawned and joined per call, like MosAlgorithm's
+        6. policy()                              → State left by the last process() call, throws before the first | Time: O(1)
 
-        --- Internal / User-defined Helpers ---
-        5. add(idx)                              → Add element at idx to current range | Time: O(1)
-        6. remove(idx)                           → Remove element at idx from current range | Time: O(1)
-        7. applyUpdate(updateIdx, forward)       → Apply or revert an update based on ‘forward’ flag | Time: O(1)
+        --- Policy (MosAlgorithm's hooks plus one for point updates) ---
+            Policy(const vector<T>& slots)    → Build the state for an empty range; slots = arr followed by
+                                                the new and old value of every update (built in process())
+            void add(int idx)                 → Element idx enters the current range
+            void remove(int idx)              → Element idx leaves the current range
+            void assign(int idx, int src)     → Position idx now holds the value of slot src
+                                                (only called while idx is outside the range)
+            AnswerType answer()               → Answer for the current range
+        Values reach the policy only through the constructor, so a compressing policy sees
+        every value an update can introduce. MosDistinctCount (default) counts distinct values.
 
         Where:
             n  = size of the array
             q  = number of queries
             u  = number of updates
             arr = input array (0-based indexing)
-            AnswerType = type of query result (default long long)
-            currentAnswer = maintained query result (customizable by user)
+            AnswerType = type of query result (default long long; not bool, checked by processParallel)
+            threads = worker count (0 = hardware_concurrency)
 
         Notes:
             • Queries and updates are mixed arbitrarily.
             • Each query is associated with the number of updates before it.
             • The time pointer ‘t’ moves forward/backward to simulate updates.
-            • You must customize `add()`, `remove()`, and possibly `applyUpdate()` for your problem.
+            • Block size is n^(2/3), giving O(n^(5/3)) moves for q, u ~ n.
 
         Example Usage:
             vector<int> arr = {1, 2, 1, 3, 2};
@@ -49,7 +59,85 @@ inline namespace MY {
             vector<long long> ans = mos.process();
     */
 
+
+#ifndef MOS_COMMON_DEFINED
+#define MOS_COMMON_DEFINED
+    enum class MosOrder { BLOCK, HILBERT };
+
+    // Index of (x, y) along the Hilbert curve filling [0, 2^pw)²
+    inline uint64_t hilbertOrder(int x, int y, int pw) {
+        uint64_t d = 0;
+        int side = 1 << pw;
+        for (int s = side >> 1; s > 0; s >>= 1) {
+            int rx = (x & s) > 0, ry = (y & s) > 0;
+            d += (uint64_t)s * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) { x = side - 1 - x; y = side - 1 - y; }
+                swap(x, y);
+            }
+        }
+        return d;
+    }
+
     template <typename T, typename AnswerType = long long>
+    class MosDistinctCount {
+        vector<int> comp;                   // compressed value per position
+        vector<int> freq;                   // one slot per distinct value
+        AnswerType distinct = 0;
+
+    public:
+        explicit MosDistinctCount(const vector<T>& arr) : comp(arr.size()) {
+            vector<T> vals(arr);
+            sort(vals.begin(), vals.end());
+            vals.erase(unique(vals.begin(), vals.end()), vals.end());
+            for (size_t i = 0; i < arr.size(); i++)
+                comp[i] = int(lower_bound(vals.begin(), vals.end(), arr[i]) - vals.begin());
+            freq.assign(vals.size(), 0);
+        }
+
+        void add(int idx) { if (freq[comp[idx]]++ == 0) distinct++; }
+        void remove(int idx) { if (--freq[comp[idx]] == 0) distinct--; }
+        AnswerType answer() const { return distinct; }
+
+        // MosAlgorithmWithUpdates: position idx takes the value of slot src
+        void assign(int idx, int src) { comp[idx] = comp[src]; }
+    };
+#endif
+
+
+#ifndef PARALLEL_HELPERS_DEFINED
+#define PARALLEL_HELPERS_DEFINED
+    // Worker count for a `threads` argument: 0 means hardware_concurrency, never below 1
+    inline int resolveThreads(int threads) {
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        return max(1, threads);
+    }
+
+    // Depth of the subtree frontier split among workers, ~4 subtrees per worker for balance
+    inline int frontierDepth(int threads) {
+        int d = 0;
+        while ((1 << d) < 4 * threads) ++d;
+        return d;
+    }
+
+    // Runs job(i) for i in [0, tasks) on `threads` workers, contiguous blocks per worker
+    template <typename Job>
+    void runParallel(int tasks, int threads, Job job) {
+        threads = min(threads, tasks);
+        if (threads <= 1) { for (int i = 0; i < tasks; ++i) job(i); return; }
+        vector<thread> pool;
+        pool.reserve(threads);
+        for (int t = 0; t < threads; ++t) {
+            int from = (int)((long long)tasks * t / threads);
+            int to = (int)((long long)tasks * (t + 1) / threads);
+            pool.emplace_back([from, to, &job]() { for (int i = from; i < to; ++i) job(i); });
+        }
+        for (auto& th : pool) th.join();
+    }
+#endif
+
+
+    template <typename T, typename AnswerType = long long, typename Policy = MosDistinctCount<T, AnswerType>>
     class MosAlgorithmWithUpdates {
     private:
         struct Query {
@@ -65,96 +153,120 @@ inline namespace MY {
         // Core data
         int n;
         int blockSize;
-        const vector<T>& originalArray;
-        vector<T> arr;
+        vector<T> arr;                      // current array (after all added updates)
         vector<Query> queries;
         vector<Update> updates;
         vector<AnswerType> answers;
+        optional<Policy> state;
 
-        // Current state
-        AnswerType currentAnswer = 0;
-        vector<int> freq;
-        int L = 0, R = -1, T = 0;
+        // Update k: slot n + k holds newVal, slot n + u + k holds oldVal
+        Policy makePolicy() const {
+            int u = updates.size();
+            vector<T> slots(arr);
+            slots.resize(n + 2 * u);
+            for (int k = u - 1; k >= 0; k--) slots[updates[k].pos] = updates[k].oldVal;   // original array
+            for (int k = 0; k < u; k++) {
+                slots[n + k] = updates[k].newVal;
+                slots[n + u + k] = updates[k].oldVal;
+            }
+            return Policy(slots);
+        }
 
-        // =======================================
-        // === User-defined core functionality ===
-        // =======================================
+        // Answers sorted queries [from, to) from the empty range at time 0 and returns st there
+        void sweep(Policy& st, int from, int to) {
+            int u = updates.size();
+            int L = 0, R = -1, time = 0;
 
-        inline void add(int idx) {
-            int x = arr[idx];
-            freq[x]++;
-            if (freq[x] == 1) currentAnswer++; // Example: counting distinct elements
-        }
+            auto applyUpdate = [&](int k, bool forward) {
+                int pos = updates[k].pos;
+                int src = forward ? n + k : n + u + k;
+                if (L <= pos && pos <= R) {
+                    st.remove(pos);
+                    st.assign(pos, src);
+                    st.add(pos);
+                } else {
+                    st.assign(pos, src);
+                }
+            };
 
-        inline void remove(int idx) {
-            int x = arr[idx];
-            freq[x]--;
-            if (freq[x] == 0) currentAnswer--;
+            for (int i = from; i < to; i++) {
+                const Query& q = queries[i];
+                while (time < q.t) applyUpdate(time++, true);
+                while (time > q.t) applyUpdate(--time, false);
+                while (L > q.l) st.add(--L);
+                while (R < q.r) st.add(++R);
+                while (L < q.l) st.remove(L++);
+                while (R > q.r) st.remove(R--);
+                answers[q.idx] = st.answer();
+            }
+            while (L <= R) st.remove(L++);
+            while (time > 0) applyUpdate(--time, false);
         }
 
-        inline void applyUpdate(int updIdx, bool forward) {
-            int pos = updates[updIdx].pos;
-            T from = forward ? updates[updIdx].oldVal : updates[updIdx].newVal;
-            T to   = forward ? updates[updIdx].newVal : updates[updIdx].oldVal;
-
-            if (L <= pos && pos <= R) {
-                remove(pos);
-                arr[pos] = to;
-                add(pos);
-            } else {
-                arr[pos] = to;
-            }
+        void prepare() {
+            answers.assign(queries.size(), AnswerType());
+
+            // Sort queries in (l/block, r/block, t)
+            sort(queries.begin(), queries.end(), [&](const Query& a, const Query& b) {
+                int blockA = a.l / blockSize;
+                int blockB = b.l / blockSize;
+                if (blockA != blockB) return blockA < blockB;
+                int blockR_A = a.r / blockSize;
+                int blockR_B = b.r / blockSize;
+                if (blockR_A != blockR_B) return blockR_A < blockR_B;
+                return a.t < b.t;
+            });
+            state.emplace(makePolicy());
         }
 
     public:
         explicit MosAlgorithmWithUpdates(const vector<T>& a)
-            : n((int)a.size()), originalArray(a), arr(a) {
-            blockSize = cbrt(max(1, n));  // cube-root optimization for Mo's with updates
-            freq.assign(1e6 + 5, 0);
+            : n((int)a.size()), arr(a) {
+            blockSize = max(1, (int)cbrt((double)n * n));   // n^(2/3) for Mo's with updates
         }
 
         void addQuery(int l, int r, int idx) {
+            if (l < 0 || r >= n || l > r) throw out_of_range("MosAlgorithmWithUpdates::addQuery - invalid range");
             queries.emplace_back(l, r, (int)updates.size(), idx);
         }
 
         void addUpdate(int pos, T newValue) {
+            if (pos < 0 || pos >= n) throw out_of_range("MosAlgorithmWithUpdates::addUpdate - invalid position");
             updates.emplace_back(pos, arr[pos], newValue);
-            arr[pos] = newValue;  // temporarily reflect the change
+            arr[pos] = newValue;
         }
 
         vector<AnswerType> process() {
-            // Restore arr to original before processing
-            arr = originalArray;
-            int q = (int)queries.size();
-            answers.assign(q, 0);
+            prepare();
+            sweep(*state, 0, (int)queries.size());
+            return answers;
+        }
 
-            // Sort queries in (l/block, r/block, t)
-            sort(queries.begin(), queries.end(), [&](const Query& a, const Query& b) {
-                int blockA = a.l / blockSize;
-                int blockB = b.l / blockSize;
-                if (blockA != blockB) return blockA < blockB;
-                int blockR_A = a.r / blockSize;
-                int blockR_B = b.r / blockSize;
-                if (blockR_A != blockR_B) return blockR_A < blockR_B;
-                return a.t < b.t;
-            });
+        vector<AnswerType> processParallel(int threads = 0) {
+            static_assert(!is_same_v<AnswerType, bool>, "processParallel: vector<bool> answers would race, use char");
+            prepare();
+            int q = queries.size();
+            threads = min(resolveThreads(threads), max(1, q));
+            if (threads == 1) { sweep(*state, 0, q); return answers; }
 
-            // Re-initialize
-            arr = originalArray;
-            L = 0; R = -1; T = 0;
-
-            // Process queries
-            for (auto& q : queries) {
-                while (T < q.t) applyUpdate(T++, true);
-                while (T > q.t) applyUpdate(--T, false);
-                while (L > q.l) add(--L);
-                while (R < q.r) add(++R);
-                while (L < q.l) remove(L++);
-                while (R > q.r) remove(R--);
-                answers[q.idx] = currentAnswer;
+            vector<thread> pool;
+            pool.reserve(threads);
+            for (int t = 0; t < threads; ++t) {
+                int from = (int)((long long)q * t / threads);
+                int to = (int)((long long)q * (t + 1) / threads);
+                pool.emplace_back([this, from, to] {
+                    Policy local(*state);
+                    sweep(local, from, to);
+                });
             }
+            for (auto& th : pool) th.join();
             return answers;
         }
+
+        Policy& policy() {
+            if (!state) throw runtime_error("MosAlgorithmWithUpdates::policy - no state before process()");
+            return *state;
+        }
     };
 
 }
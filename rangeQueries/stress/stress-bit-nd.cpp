@@ -0,0 +1,130 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+#include "../fenwickTree/BIT_ND.cpp"
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        BIT_ND Stress Checker
+        ===============================
+
+        Replays seeded random box updates and queries against BIT_ND<long long, D> and a
+        dense brute-force grid for D = 1..4, and stops at the first mismatch, printing the
+        seed, D, the case and the operation. Sizes are small and include n_k = 1 so that
+        degenerate axes and boxes touching the grid border are exercised.
+
+        Build & run:
+            g++ -O2 -std=c++17 -fsanitize=address,undefined stress-bit-nd.cpp -o stress-bit-nd
+            ./stress-bit-nd --cases 500 --ops 200 --seed 1
+
+        Options:
+            --cases C     random grids per dimension count     (default 500)
+            --ops Q       operations per grid                   (default 200)
+            --seed S      RNG seed                              (default 1)
+
+        Checked operations:
+            rangeAdd, pointAdd                  (updates)
+            rangeSum, prefixSum, pointQuery     (queries)
+
+        Exit code 0 and "OK" when every answer matches, 1 otherwise.
+    */
+
+
+    struct BitNDStress {
+        int cases = 500, ops = 200;
+        uint64_t seed = 1;
+
+        template <int D>
+        bool runDim() {
+            using Point = array<int, D>;
+            static const int maxSide[] = {0, 200, 14, 7, 5};
+            mt19937_64 rng(seed * 31 + D);
+            auto rnd = [&](long long lo, long long hi) { return lo + (long long)(rng() % (uint64_t)(hi - lo + 1)); };
+
+            for (int tc = 0; tc < cases; ++tc) {
+                Point dims;
+                int cells = 1;
+                for (int k = 0; k < D; ++k) { dims[k] = (int)rnd(1, maxSide[D]); cells *= dims[k]; }
+                BIT_ND<long long, D> bit(dims);
+                vector<long long> grid(cells, 0);
+
+                // row-major index of a 1-indexed point
+                auto flat = [&](const Point& p) {
+                    int id = 0;
+                    for (int k = 0; k < D; ++k) id = id * dims[k] + (p[k] - 1);
+                    return id;
+                };
+                // calls f(p) for every p in the box [lo, hi]
+                auto forBox = [&](const Point& lo, const Point& hi, auto&& f) {
+                    Point p = lo;
+                    while (true) {
+                        f(p);
+                        int k = D - 1;
+                        while (k >= 0 && p[k] == hi[k]) { p[k] = lo[k]; --k; }
+                        if (k < 0) return;
+                        ++p[k];
+                    }
+                };
+                auto randomBox = [&](Point& lo, Point& hi) {
+                    for (int k = 0; k < D; ++k) {
+                        lo[k] = (int)rnd(1, dims[k]); hi[k] = (int)rnd(1, dims[k]);
+                        if (lo[k] > hi[k]) swap(lo[k], hi[k]);
+                    }
+                };
+
+                for (int t = 0; t < ops; ++t) {
+                    Point lo, hi;
+                    randomBox(lo, hi);
+                    long long val = rnd(-1000000, 1000000);
+                    int op = (int)rnd(0, 4);
+                    long long got = 0, want = 0;
+
+                    if (op == 0) { bit.rangeAdd(lo, hi, val); forBox(lo, hi, [&](const Point& p) { grid[flat(p)] += val; }); continue; }
+                    if (op == 1) { bit.pointAdd(lo, val); grid[flat(lo)] += val; continue; }
+                    if (op == 2) { got = bit.rangeSum(lo, hi); forBox(lo, hi, [&](const Point& p) { want += grid[flat(p)]; }); }
+                    else if (op == 3) {
+                        // corners past the grid are clamped to it
+                        Point one, x; one.fill(1);
+                        for (int k = 0; k < D; k++) x[k] = hi[k] == dims[k] ? hi[k] + (int)rnd(0, 3) : hi[k];
+                        got = bit.prefixSum(x); forBox(one, hi, [&](const Point& p) { want += grid[flat(p)]; });
+                    }
+                    else { got = bit.pointQuery(lo); want = grid[flat(lo)]; }
+
+                    if (got != want) {
+                        static const char* names[] = {"rangeAdd", "pointAdd", "rangeSum", "prefixSum", "pointQuery"};
+                        printf("MISMATCH seed=%llu D=%d case=%d op#%d %s: got %lld, want %lld\n",
+                               (unsigned long long)seed, D, tc, t, names[op], got, want);
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool run() { return runDim<1>() && runDim<2>() && runDim<3>() && runDim<4>(); }
+    };
+}
+
+
+
+
+int main(int argc, char** argv) {
+    BitNDStress s;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string k = argv[i], v = argv[i + 1];
+        if (k == "--cases") s.cases = stoi(v);
+        else if (k == "--ops") s.ops = stoi(v);
+        else if (k == "--seed") s.seed = stoull(v);
+        else { fprintf(stderr, "unknown option %s\n", k.c_str()); return 2; }
+    }
+    if (!s.run()) return 1;
+    puts("OK");
+    return 0;
+}
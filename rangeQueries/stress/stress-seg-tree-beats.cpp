@@ -0,0 +1,103 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+#include "../segmentTree/segment-tree-beats.cpp"
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        SegTreeBeats Stress Checker
+        ===============================
+
+        Replays seeded random operation streams against SegTreeBeats and a plain array
+        and stops at the first mismatch, printing the seed, the case and the operation.
+        Small n and small values are mixed in so that clamps often hit ties (count of
+        max/min > 1) and collapse a node to a single distinct value.
+
+        Build & run:
+            g++ -O2 -std=c++17 -fsanitize=address,undefined stress-seg-tree-beats.cpp -o stress-beats
+            ./stress-beats --cases 2000 --ops 300 --seed 1
+
+        Options:
+            --cases C     random arrays to test                 (default 2000)
+            --ops Q       operations per array                  (default 300)
+            --max-n N     array size drawn from [1, N]          (default 64)
+            --seed S      RNG seed                              (default 1)
+
+        Checked operations:
+            rangeChmin, rangeChmax, rangeAdd, pointAssign (updates)
+            rangeSum, rangeMin, rangeMax, pointQuery       (queries)
+
+        Exit code 0 and "OK" when every answer matches, 1 otherwise.
+    */
+
+
+    struct BeatsStress {
+        int cases = 2000, ops = 300, maxN = 64;
+        uint64_t seed = 1;
+
+        bool run() {
+            mt19937_64 rng(seed);
+            auto rnd = [&](long long lo, long long hi) { return lo + (long long)(rng() % (uint64_t)(hi - lo + 1)); };
+
+            for (int tc = 0; tc < cases; ++tc) {
+                int n = (int)rnd(1, maxN);
+                long long V = (tc & 1) ? 10 : 1000000000LL;
+                vector<long long> a(n);
+                for (auto& x : a) x = rnd(-V, V);
+                SegTreeBeats<long long> st(a);
+
+                for (int t = 0; t < ops; ++t) {
+                    int L = (int)rnd(0, n - 1), R = (int)rnd(0, n - 1);
+                    if (L > R) swap(L, R);
+                    long long x = rnd(-V, V);
+                    int op = (int)rnd(0, 7);
+                    long long got = 0, want = 0;
+
+                    switch (op) {
+                        case 0: st.rangeChmin(L, R, x); for (int i = L; i <= R; ++i) a[i] = min(a[i], x); continue;
+                        case 1: st.rangeChmax(L, R, x); for (int i = L; i <= R; ++i) a[i] = max(a[i], x); continue;
+                        case 2: st.rangeAdd(L, R, x);   for (int i = L; i <= R; ++i) a[i] += x;          continue;
+                        case 3: st.pointAssign(L, x);   a[L] = x;                                        continue;
+                        case 4: got = st.rangeSum(L, R); want = accumulate(a.begin() + L, a.begin() + R + 1, 0LL); break;
+                        case 5: got = st.rangeMin(L, R); want = *min_element(a.begin() + L, a.begin() + R + 1); break;
+                        case 6: got = st.rangeMax(L, R); want = *max_element(a.begin() + L, a.begin() + R + 1); break;
+                        default: got = st.pointQuery(L); want = a[L]; break;
+                    }
+                    if (got != want) {
+                        static const char* names[] = {"rangeChmin", "rangeChmax", "rangeAdd", "pointAssign",
+                                                      "rangeSum", "rangeMin", "rangeMax", "pointQuery"};
+                        printf("MISMATCH seed=%llu case=%d op#%d %s(%d, %d): got %lld, want %lld\n",
+                               (unsigned long long)seed, tc, t, names[op], L, R, got, want);
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+    };
+}
+
+
+
+
+int main(int argc, char** argv) {
+    BeatsStress s;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string k = argv[i], v = argv[i + 1];
+        if (k == "--cases") s.cases = stoi(v);
+        else if (k == "--ops") s.ops = stoi(v);
+        else if (k == "--max-n") s.maxN = stoi(v);
+        else if (k == "--seed") s.seed = stoull(v);
+        else { fprintf(stderr, "unknown option %s\n", k.c_str()); return 2; }
+    }
+    if (!s.run()) return 1;
+    puts("OK");
+    return 0;
+}
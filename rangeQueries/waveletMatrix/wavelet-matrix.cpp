@@ -0,0 +1,215 @@
+#include<bits/stdc++.h>
+#include<ext/pb_ds/assoc_container.hpp>
+#include<ext/pb_ds/tree_policy.hpp>
+using namespace __gnu_pbds;
+using namespace std;
+
+
+
+
+inline namespace MY{
+    /*
+        ===============================
+        WaveletMatrix Class — Function Complexities
+        ===============================
+
+        Static order-statistic queries on a subarray (k-th smallest, counts, predecessor /
+        successor) without the n log n words of a merge-sort tree or a persistent tree.
+
+        The array is compressed to [0, σ) (CoordinateCompressor) and stored as log σ levels.
+        Level b holds bit b of every value, elements ordered by the stable partition of the
+        level above (zeros first). Each level is a bitvector of 64-bit words with a rank
+        directory of one uint32 per 256 bits, so rank is one directory read plus at most
+        four popcounts and a query walks the levels top-down keeping two positions.
+
+        1. WaveletMatrix(comp, sortedUnique)      → Constructor from compressed array + values | Time: O(n log σ) | Space: see below
+        2. WaveletMatrix(cc)                      → Constructor from a CoordinateCompressor<T> | Time: O(n log σ)
+        3. kth(L, R, k)                           → k-th smallest (1-based k) in arr[L..R]     | Time: O(log σ) | Space: O(1)
+        4. rank(L, R, x)                          → #{i in [L, R] : arr[i] == x}               | Time: O(log σ) | Space: O(1)
+        5. countLess(L, R, x)                     → #{i in [L, R] : arr[i] < x}                | Time: O(log σ) | Space: O(1)
+        6. rangeFreq(L, R, lo, hi)                → #{i in [L, R] : lo <= arr[i] <= hi}        | Time: O(log σ) | Space: O(1)
+        7. prevValue(L, R, x)                     → Largest arr[i] <= x on [L, R], or nullopt  | Time: O(log σ) | Space: O(1)
+        8. nextValue(L, R, x)                     → Smallest arr[i] >= x on [L, R], or nullopt | Time: O(log σ) | Space: O(1)
+        9. size() / levels() / memoryBytes()      → Bookkeeping                                | Time: O(1)
+
+        Where:
+            n      = number of elements, σ = number of distinct values
+            L, R   = 0-based inclusive indices, invalid ranges throw out_of_range
+            x, lo, hi = original values (need not occur in the array)
+            Space  = about n · ⌈log2 σ⌉ · 1.125 bits + σ values of T
+
+        Usage Example:
+            CoordinateCompressor<long long> cc(a);
+            WaveletMatrix<long long> wm(cc);        // or wm(cc.get_compressed(), cc.get_sorted_unique_original())
+            long long med = wm.kth(l, r, (r - l + 2) / 2);
+            int below = wm.countLess(l, r, x);
+            auto p = wm.prevValue(l, r, x);         // optional<long long>
+    */
+
+
+    template <typename T>
+    class WaveletMatrix {
+    private:
+        struct BitLevel {
+            vector<uint64_t> words;         // bit i of the level, one extra word as sentinel
+            vector<uint32_t> dir;           // dir[s] = ones before bit 256 * s
+            int zeros = 0;                  // elements with this bit clear (they come first below)
+
+            void init(int n) {
+                words.assign(n / 64 + 1, 0);
+            }
+
+            inline void set(int i) { words[i >> 6] |= 1ULL << (i & 63); }
+
+            void buildDirectory() {
+                dir.assign(words.size() / 4 + 1, 0);
+                uint32_t acc = 0;
+                for (size_t w = 0; w < words.size(); ++w) {
+                    if ((w & 3) == 0) dir[w >> 2] = acc;
+                    acc += __builtin_popcountll(words[w]);
+                }
+            }
+
+            // ones in [0, i)
+            inline int rank1(int i) const {
+                int w = i >> 6;
+                int r = dir[w >> 2];
+                for (int k = w & ~3; k < w; ++k) r += __builtin_popcountll(words[k]);
+                return r + __builtin_popcountll(words[w] & ((1ULL << (i & 63)) - 1));
+            }
+
+            inline int rank0(int i) const { return i - rank1(i); }
+        };
+
+        int n = 0, sigma = 0, LOG = 0;
+        vector<BitLevel> level;             // level[b] holds bit b, walked from LOG - 1 down to 0
+        vector<T> vals;                     // sorted unique values
+
+        [[noreturn]] __attribute__((noinline, cold)) void invalidRange(const char* where) const {
+            throw out_of_range(string("WaveletMatrix::") + where + " - invalid range");
+        }
+
+        inline void check(int L, int R, const char* where) const {
+            if (__builtin_expect((unsigned)R >= (unsigned)n || (unsigned)L > (unsigned)R, 0)) invalidRange(where);
+        }
+
+        void build(vector<int> cur) {
+            LOG = sigma > 1 ? 32 - __builtin_clz((unsigned)(sigma - 1)) : 0;
+            level.assign(LOG, BitLevel());
+            vector<int> nxt(n);
+            for (int b = LOG - 1; b >= 0; --b) {
+                BitLevel& lv = level[b];
+                lv.init(n);
+                int z = 0;
+                for (int i = 0; i < n; ++i) if (!((cur[i] >> b) & 1)) z++;
+                lv.zeros = z;
+                int p0 = 0, p1 = z;
+                for (int i = 0; i < n; ++i) {
+                    if ((cur[i] >> b) & 1) { lv.set(i); nxt[p1++] = cur[i]; }
+                    else nxt[p0++] = cur[i];
+                }
+                lv.buildDirectory();
+                swap(cur, nxt);
+            }
+        }
+
+        // k-th smallest compressed value (0-based k) on [l, r)
+        int kthCompressed(int l, int r, int k) const {
+            int res = 0;
+            for (int b = LOG - 1; b >= 0; --b) {
+                const BitLevel& lv = level[b];
+                int zl = lv.rank0(l), zr = lv.rank0(r);
+                if (k < zr - zl) { l = zl; r = zr; }
+                else {
+                    k -= zr - zl;
+                    res |= 1 << b;
+                    l = lv.zeros + (l - zl);
+                    r = lv.zeros + (r - zr);
+                }
+            }
+            return res;
+        }
+
+        // elements on [l, r) with compressed value < c, c in [0, σ]
+        int lessCompressed(int l, int r, int c) const {
+            if (c >= (1 << LOG)) return r - l;
+            int res = 0;
+            for (int b = LOG - 1; b >= 0 && l < r; --b) {
+                const BitLevel& lv = level[b];
+                int zl = lv.rank0(l), zr = lv.rank0(r);
+                if ((c >> b) & 1) {
+                    res += zr - zl;
+                    l = lv.zeros + (l - zl);
+                    r = lv.zeros + (r - zr);
+                } else { l = zl; r = zr; }
+            }
+            return res;
+        }
+
+        int lowerIndex(const T& x) const { return int(lower_bound(vals.begin(), vals.end(), x) - vals.begin()); }
+        int upperIndex(const T& x) const { return int(upper_bound(vals.begin(), vals.end(), x) - vals.begin()); }
+
+    public:
+        WaveletMatrix() = default;
+
+        WaveletMatrix(const vector<int>& comp, vector<T> sortedUnique)
+            : n((int)comp.size()), sigma((int)sortedUnique.size()), vals(move(sortedUnique)) {
+            for (int c : comp)
+                if (c < 0 || c >= sigma) throw invalid_argument("WaveletMatrix: compressed value outside [0, sigma)");
+            build(comp);
+        }
+
+        template <typename Compressor>
+        explicit WaveletMatrix(const Compressor& cc)
+            : WaveletMatrix(cc.get_compressed(), cc.get_sorted_unique_original()) {}
+
+        // k-th smallest (1-based) in arr[L..R]
+        T kth(int L, int R, int k) const {
+            check(L, R, "kth");
+            if (k < 1 || k > R - L + 1) throw out_of_range("WaveletMatrix::kth - invalid k");
+            return vals[kthCompressed(L, R + 1, k - 1)];
+        }
+
+        int rank(int L, int R, const T& x) const {
+            check(L, R, "rank");
+            int c = lowerIndex(x);
+            if (c == sigma || vals[c] != x) return 0;
+            return lessCompressed(L, R + 1, c + 1) - lessCompressed(L, R + 1, c);
+        }
+
+        int countLess(int L, int R, const T& x) const {
+            check(L, R, "countLess");
+            return lessCompressed(L, R + 1, lowerIndex(x));
+        }
+
+        int rangeFreq(int L, int R, const T& lo, const T& hi) const {
+            check(L, R, "rangeFreq");
+            if (hi < lo) return 0;
+            return lessCompressed(L, R + 1, upperIndex(hi)) - lessCompressed(L, R + 1, lowerIndex(lo));
+        }
+
+        optional<T> prevValue(int L, int R, const T& x) const {
+            check(L, R, "prevValue");
+            int cnt = lessCompressed(L, R + 1, upperIndex(x));
+            if (cnt == 0) return nullopt;
+            return vals[kthCompressed(L, R + 1, cnt - 1)];
+        }
+
+        optional<T> nextValue(int L, int R, const T& x) const {
+            check(L, R, "nextValue");
+            int cnt = lessCompressed(L, R + 1, lowerIndex(x));
+            if (cnt == R - L + 1) return nullopt;
+            return vals[kthCompressed(L, R + 1, cnt)];
+        }
+
+        int size() const { return n; }
+
+        int levels() const { return LOG; }
+
+        size_t memoryBytes() const {
+            size_t bytes = vals.size() * sizeof(T);
+            for (const BitLevel& lv : level) bytes += lv.words.size() * sizeof(uint64_t) + lv.dir.size() * sizeof(uint32_t);
+            return bytes;
+        }
+    };
+}